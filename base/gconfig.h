@@ -174,6 +174,7 @@ oper_(zcolor_ext_op_defs)
 oper_(zdevice_op_defs)
 oper_(zfont_op_defs)
 oper_(zfontenum_op_defs)
+oper_(zfontidx_op_defs)
 oper_(zgstate1_op_defs)
 oper_(zgstate2_op_defs)
 oper_(zgstate3_op_defs)
@@ -55,14 +55,13 @@ static uint prev_colors[256];
 
 /* Procedures */
 declare_mem_procs(mem_true24_copy_mono, mem_true24_copy_color, mem_true24_fill_rectangle);
-static dev_proc_copy_alpha(mem_true24_copy_alpha);
 
 /* The device descriptor. */
 const gx_device_memory mem_true24_device =
 mem_full_alpha_device("image24", 24, 0, mem_open,
                  gx_default_rgb_map_rgb_color, gx_default_rgb_map_color_rgb,
      mem_true24_copy_mono, mem_true24_copy_color, mem_true24_fill_rectangle,
-                      gx_default_map_cmyk_color, mem_true24_copy_alpha,
+                      gx_default_map_cmyk_color, mem_copy_alpha_bytes,
                  gx_default_strip_tile_rectangle, mem_true24_strip_copy_rop,
                       mem_get_bits_rectangle);
 
@@ -475,51 +474,6 @@ mem_true24_copy_color(gx_device * dev,
     return 0;
 }
 
-/* Copy an alpha map. */
-static int
-mem_true24_copy_alpha(gx_device * dev, const byte * base, int sourcex,
-                   int sraster, gx_bitmap_id id, int x, int y, int w, int h,
-                      gx_color_index color, int depth)
-{
-    gx_device_memory * const mdev = (gx_device_memory *)dev;
-    const byte *line;
-
-    declare_scan_ptr(dest);
-    declare_unpack_color(r, g, b, color);
-
-    fit_copy(dev, base, sourcex, sraster, id, x, y, w, h);
-    setup_rect(dest);
-    line = base;
-    while (h-- > 0) {
-        register byte *pptr = dest;
-        int sx;
-
-        for (sx = sourcex; sx < sourcex + w; ++sx, pptr += 3) {
-            int alpha2, alpha;
-
-            if (depth == 2)	/* map 0 - 3 to 0 - 15 */
-                alpha =
-                    ((line[sx >> 2] >> ((3 - (sx & 3)) << 1)) & 3) * 5;
-            else
-                alpha2 = line[sx >> 1],
-                    alpha = (sx & 1 ? alpha2 & 0xf : alpha2 >> 4);
-            if (alpha == 15) {	/* Just write the new color. */
-                put3(pptr, r, g, b);
-            } else if (alpha != 0) {	/* Blend RGB values. */
-#define make_shade(old, clr, alpha, amax) \
-  (old) + (((int)(clr) - (int)(old)) * (alpha) / (amax))
-                pptr[0] = make_shade(pptr[0], r, alpha, 15);
-                pptr[1] = make_shade(pptr[1], g, alpha, 15);
-                pptr[2] = make_shade(pptr[2], b, alpha, 15);
-#undef make_shade
-            }
-        }
-        line += sraster;
-        inc_ptr(dest, draster);
-    }
-    return 0;
-}
-
 /* ================ "Word"-oriented device ================ */
 
 /* Note that on a big-endian machine, this is the same as the */
@@ -90,6 +90,8 @@ dev_proc_draw_thin_line(mem_draw_thin_line);
 /* The following are used for all except planar or word-oriented devices. */
 dev_proc_open_device(mem_open);
 dev_proc_get_bits_rectangle(mem_get_bits_rectangle);
+/* copy_alpha for devices whose pixels are made of 8-bit components. */
+dev_proc_copy_alpha(mem_copy_alpha_bytes);
 /* The following are for word-oriented devices. */
 #if arch_is_big_endian
 #  define mem_word_get_bits_rectangle mem_get_bits_rectangle
@@ -351,6 +351,7 @@ int gp_cache_query(int type, byte* key, int keylen, void **buffer,
 /* cache data types */
 #define GP_CACHE_TYPE_TEST 0
 #define GP_CACHE_TYPE_FONTMAP 1
+#define GP_CACHE_TYPE_GLYPHS 2
 
 /* ------ Printer accessing ------ */
 
@@ -118,3 +118,9 @@ void
 gp_thread_finish(gp_thread_id thread)
 {
 }
+
+int
+gp_get_cpu_count(void)
+{
+    return 1;
+}
@@ -17,6 +17,7 @@
 /* POSIX pthreads threads / semaphore / monitor implementation */
 #include "std.h"
 #include "malloc_.h"
+#include "unistd_.h"
 #include <pthread.h>
 #include "gserrors.h"
 #include "gpsync.h"
@@ -281,3 +282,14 @@ void gp_thread_finish(gp_thread_id thread)
         return;
     pthread_join((pthread_t)thread, NULL);
 }
+
+int gp_get_cpu_count(void)
+{
+#ifdef _SC_NPROCESSORS_ONLN
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (n < 1 ? 1 : n > max_int ? max_int : (int)n);
+#else
+    return 1;
+#endif
+}
@@ -19,7 +19,8 @@
 #include "stdio_.h"
 #include "string_.h"
 #include "time_.h"
-#include <stdlib.h> /* should use gs_malloc() instead */
+#include "unistd_.h"
+#include <stdlib.h> /* should use gs_malloc() instead; also mkstemp */
 #include "gconfigd.h"
 #include "gp.h"
 #include "md5.h"
@@ -194,6 +195,44 @@ static char *gp_cache_itempath(const char *prefix, gp_cache_entry *item)
     return path;
 }
 
+/* Create a new, uniquely named file in the same directory as path, so
+   that it can replace path with rename().  Several processes may share
+   the cache, so the name can't be a fixed function of path. */
+static FILE *gp_cache_tempfile(const char *path, char **ptmpfn)
+{
+    int len = strlen(path) + 8;
+    char *tmpfn = malloc(len);
+    FILE *file = NULL;
+
+    *ptmpfn = NULL;
+    if (tmpfn == NULL)
+        return NULL;
+    memcpy(tmpfn, path, len - 8);
+    strcpy(tmpfn + len - 8, ".XXXXXX");
+#ifdef HAVE_MKSTEMP
+    {
+        int fd = mkstemp(tmpfn);
+
+        if (fd >= 0) {
+            file = fdopen(fd, "wb");
+            if (file == NULL) {
+                close(fd);
+                unlink(tmpfn);
+            }
+        }
+    }
+#else
+    if (mktemp(tmpfn) != NULL && *tmpfn != 0)
+        file = fopen(tmpfn, "wb");
+#endif
+    if (file == NULL) {
+        free(tmpfn);
+        return NULL;
+    }
+    *ptmpfn = tmpfn;
+    return file;
+}
+
 static int gp_cache_saveitem(FILE *file, gp_cache_entry* item)
 {
     unsigned char version = 0;
@@ -337,29 +376,16 @@ int gp_cache_insert(int type, byte *key, int keylen, void *buffer, int buflen)
     /* FIXME: not re-entrant! */
     prefix = gp_cache_prefix();
     infn = gp_cache_indexfilename(prefix);
-    {
-        int len = strlen(infn) + 2;
-        outfn = malloc(len);
-        memcpy(outfn, infn, len - 2);
-        outfn[len-2] = '+';
-        outfn[len-1] = '\0';
-    }
 
+    /* A missing index is the same as an empty one. */
     in = fopen(infn, "r");
-    if (in == NULL) {
-        dlprintf1("pcache: unable to open '%s'\n", infn);
-        free(prefix);
-        free(infn);
-        free(outfn);
-        return -1;
-    }
-    out = fopen(outfn, "w");
+    out = gp_cache_tempfile(infn, &outfn);
     if (out == NULL) {
-        dlprintf1("pcache: unable to open '%s'\n", outfn);
-        fclose(in);
+        dlprintf1("pcache: unable to create a new index for '%s'\n", infn);
+        if (in != NULL)
+            fclose(in);
         free(prefix);
         free(infn);
-        free(outfn);
         return -1;
     }
 
@@ -377,18 +403,26 @@ int gp_cache_insert(int type, byte *key, int keylen, void *buffer, int buflen)
     gp_cache_hash(&item);
     gp_cache_filename(prefix, &item);
 
-    /* save it to disk */
+    /* save it to disk, under a temporary name so that a process
+       reading the item never sees it half written */
     path = gp_cache_itempath(prefix, &item);
-    file = fopen(path, "wb");
-    free(path);
-    if (file != NULL) {
-        gp_cache_saveitem(file, &item);
-        fclose(file);
+    {
+        char *tmpfn;
+
+        file = gp_cache_tempfile(path, &tmpfn);
+        if (file != NULL) {
+            gp_cache_saveitem(file, &item);
+            fclose(file);
+            if (rename(tmpfn, path) != 0)
+                unlink(tmpfn);
+            free(tmpfn);
+        }
     }
+    free(path);
 
     /* now loop through the index to update or insert the entry */
     gp_cache_clear_entry(&item2);
-    while ((code = gp_cache_read_entry(in, &item2)) >= 0) {
+    while (in != NULL && (code = gp_cache_read_entry(in, &item2)) >= 0) {
         if (code == 1) continue;
         if (!memcmp(item.hash, item2.hash, 16)) {
             /* replace the matching line */
@@ -405,11 +439,12 @@ int gp_cache_insert(int type, byte *key, int keylen, void *buffer, int buflen)
     }
     free(item.filename);
     fclose(out);
-    fclose(in);
+    if (in != NULL)
+        fclose(in);
 
     /* replace the cache index with our new version */
-    unlink(infn);
-    rename(outfn,infn);
+    if (rename(outfn, infn) != 0)
+        unlink(outfn);
 
     free(prefix);
     free(infn);
@@ -430,29 +465,16 @@ int gp_cache_query(int type, byte* key, int keylen, void **buffer,
     /* FIXME: not re-entrant! */
     prefix = gp_cache_prefix();
     infn = gp_cache_indexfilename(prefix);
-    {
-        int len = strlen(infn) + 2;
-        outfn = malloc(len);
-        memcpy(outfn, infn, len - 2);
-        outfn[len-2] = '+';
-        outfn[len-1] = '\0';
-    }
 
+    /* A missing index is the same as an empty one. */
     in = fopen(infn, "r");
-    if (in == NULL) {
-        dlprintf1("pcache: unable to open '%s'\n", infn);
-        free(prefix);
-        free(infn);
-        free(outfn);
-        return -1;
-    }
-    out = fopen(outfn, "w");
+    out = gp_cache_tempfile(infn, &outfn);
     if (out == NULL) {
-        dlprintf1("pcache: unable to open '%s'\n", outfn);
-        fclose(in);
+        dlprintf1("pcache: unable to create a new index for '%s'\n", infn);
+        if (in != NULL)
+            fclose(in);
         free(prefix);
         free(infn);
-        free(outfn);
         return -1;
     }
 
@@ -479,7 +501,7 @@ int gp_cache_query(int type, byte* key, int keylen, void **buffer,
     }
 
     gp_cache_clear_entry(&item2);
-    while ((code = gp_cache_read_entry(in, &item2)) >= 0) {
+    while (in != NULL && (code = gp_cache_read_entry(in, &item2)) >= 0) {
         if (code == 1) continue;
         if (!hit && !memcmp(item.hash, item2.hash, 16)) {
             /* replace the matching line */
@@ -496,11 +518,12 @@ int gp_cache_query(int type, byte* key, int keylen, void **buffer,
     }
     free(item.filename);
     fclose(out);
-    fclose(in);
+    if (in != NULL)
+        fclose(in);
 
     /* replace the cache index with our new version */
-    unlink(infn);
-    rename(outfn,infn);
+    if (rename(outfn, infn) != 0)
+        unlink(outfn);
 
     free(prefix);
     free(infn);
@@ -276,3 +276,12 @@ void gp_thread_finish(gp_thread_id thread)
     CloseHandle((HANDLE)thread);
 #endif
 }
+
+int gp_get_cpu_count(void)
+{
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+    return (info.dwNumberOfProcessors < 1 ? 1 :
+            (int)info.dwNumberOfProcessors);
+}
@@ -102,4 +102,10 @@ int gp_thread_start(gp_thread_creation_callback_t fun, void *arg, gp_thread_id *
  */
 void gp_thread_finish(gp_thread_id thread);
 
+/*
+ * Return the number of processors available to this process, at least 1.
+ * Callers that start several threads of their own use this as a limit.
+ */
+int gp_get_cpu_count(void);
+
 #endif /* !defined(gpsync_INCLUDED) */
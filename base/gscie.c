@@ -29,6 +29,7 @@
 #include "gxcmap.h"
 #include "gzstate.h"
 #include "gsicc.h"
+#include "gxcpcache.h"
 
 /*
  * Define whether to optimize the CIE mapping process by combining steps.
@@ -1423,6 +1424,9 @@ gx_cie_to_xyz_free(gs_imager_state *pis)
     if (pis->icc_profile_cache != NULL) {
         rc_decrement(pis->icc_profile_cache,"gx_cie_to_xyz_free");
     }
+    if (pis->clip_cache != NULL) {
+        rc_decrement(pis->clip_cache,"gx_cie_to_xyz_free");
+    }
     gs_free_object(mem, pis, "gx_cie_to_xyz_free(imager state)");
 }
 
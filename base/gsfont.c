@@ -257,6 +257,7 @@ gs_font_dir_alloc2_limits(gs_memory_t * struct_mem, gs_memory_t * bits_mem,
         gs_free_object(struct_mem, pdir, "font_dir_alloc(dir)");
         return 0;
     }
+    pdir->ccache.hits = pdir->ccache.misses = pdir->ccache.evictions = 0;
     pdir->orig_fonts = 0;
     pdir->scaled_fonts = 0;
     pdir->ssize = 0;
@@ -264,10 +265,14 @@ gs_font_dir_alloc2_limits(gs_memory_t * struct_mem, gs_memory_t * bits_mem,
     pdir->align_to_pixels = false;
     pdir->glyph_to_unicode_table = NULL;
     pdir->grid_fit_tt = 2;
+    pdir->glyph_disk_cache = false;
+    pdir->fapi_threads = 0;
     pdir->memory = struct_mem;
     pdir->tti = 0;
     pdir->ttm = 0;
     pdir->san = 0;
+    pdir->hint_tables = 0;
+    pdir->hint_tables_stamp = 0;
     pdir->global_glyph_code = NULL;
     pdir->text_enum_id = 0;
     pdir->hash = 42;  /* initialize the hash to a randomly picked number */
@@ -640,6 +645,15 @@ gs_cachestatus(register const gs_font_dir * pdir, register uint pstat[7])
     pstat[6] = pdir->ccache.upper;
 }
 
+/* Character cache statistics: hits, misses, evictions. */
+void
+gs_cachestats(const gs_font_dir * pdir, ulong pstat[3])
+{
+    pstat[0] = pdir->ccache.hits;
+    pstat[1] = pdir->ccache.misses;
+    pstat[2] = pdir->ccache.evictions;
+}
+
 /* setcacheparams */
 int
 gs_setcachesize(gs_state * pgs, gs_font_dir * pdir, uint size)
@@ -665,6 +679,12 @@ gs_setcachesize(gs_state * pgs, gs_font_dir * pdir, uint size)
 
     /* now free the cache structures and rebuild everything with the
        new cache size */
+    {
+        uint i;
+
+        for (i = 0; i < pdir->fmcache.mmax; i++)
+            gx_glyph_strike_close(pdir, pdir->fmcache.mdata + i);
+    }
     gs_free_object(stable_mem, pdir->fmcache.mdata, "gs_setcachesize(mdata)");
     gs_free_object(stable_mem, pdir->ccache.table, "gs_setcachesize(table)");
     pdir->ccache.bmax = size;
@@ -697,6 +717,18 @@ gs_setgridfittt(gs_font_dir * pdir, uint v)
     pdir->grid_fit_tt = v;
     return 0;
 }
+int
+gs_setglyphdiskcache(gs_font_dir * pdir, bool v)
+{
+    pdir->glyph_disk_cache = v;
+    return 0;
+}
+int
+gs_setfapithreads(gs_font_dir * pdir, uint v)
+{
+    pdir->fapi_threads = v;
+    return 0;
+}
 
 /* currentcacheparams */
 uint
@@ -724,6 +756,16 @@ gs_currentgridfittt(const gs_font_dir * pdir)
 {
     return pdir->grid_fit_tt;
 }
+bool
+gs_currentglyphdiskcache(const gs_font_dir * pdir)
+{
+    return pdir->glyph_disk_cache;
+}
+uint
+gs_currentfapithreads(const gs_font_dir * pdir)
+{
+    return pdir->fapi_threads;
+}
 
 /* Purge a font from all font- and character-related tables. */
 /* This is only used by restore (and, someday, the GC). */
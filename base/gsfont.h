@@ -75,6 +75,7 @@ gs_font *gs_find_font_by_id(gs_font_dir *pdir, gs_id id, gs_matrix *FontMatrix);
 
 /* Font cache parameter operations */
 void gs_cachestatus(const gs_font_dir *, uint[7]);
+void gs_cachestats(const gs_font_dir *, ulong[3]);
 
 #define gs_setcachelimit(pdir,limit) gs_setcacheupper(pdir,limit)
 uint gs_currentcachesize(const gs_font_dir *);
@@ -87,5 +88,10 @@ uint gs_currentaligntopixels(const gs_font_dir *);
 int gs_setaligntopixels(gs_font_dir *, uint);
 uint gs_currentgridfittt(const gs_font_dir *);
 int gs_setgridfittt(gs_font_dir *, uint);
+bool gs_currentglyphdiskcache(const gs_font_dir *);
+int gs_setglyphdiskcache(gs_font_dir *, bool);
+uint gs_currentfapithreads(const gs_font_dir *);
+int gs_setfapithreads(gs_font_dir *, uint);
+void gs_font_dir_save_glyphs(gs_font_dir *);
 
 #endif /* gsfont_INCLUDED */
@@ -91,6 +91,22 @@ gs_function_get_info_default(const gs_function_t *pfn, gs_function_info_t *pfi)
     pfi->Functions = 0;
 }
 
+/* Evaluate a function at several points, one at a time. */
+int
+gs_function_evaluate_batch_default(const gs_function_t *pfn, int count,
+                                   const float *in, float *out)
+{
+    int m = pfn->params.m, n = pfn->params.n;
+    int i, code;
+
+    for (i = 0; i < count; i++, in += m, out += n) {
+        code = gs_function_evaluate(pfn, in, out);
+        if (code < 0)
+            return code;
+    }
+    return 0;
+}
+
 /*
  * Write generic parameters (FunctionType, Domain, Range) on a parameter list.
  */
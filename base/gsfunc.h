@@ -122,6 +122,11 @@ typedef FN_FREE_PROC((*fn_free_proc_t));
   int proc(const gs_function_t * pfn, stream *s)
 typedef FN_SERIALIZE_PROC((*fn_serialize_proc_t));
 
+/* Evaluate a function at count points. */
+#define FN_EVALUATE_BATCH_PROC(proc)\
+  int proc(const gs_function_t * pfn, int count, const float *in, float *out)
+typedef FN_EVALUATE_BATCH_PROC((*fn_evaluate_batch_proc_t));
+
 /* Define the generic function structures. */
 typedef struct gs_function_procs_s {
     fn_evaluate_proc_t evaluate;
@@ -132,6 +137,7 @@ typedef struct gs_function_procs_s {
     fn_free_params_proc_t free_params;
     fn_free_proc_t free;
     fn_serialize_proc_t serialize;
+    fn_evaluate_batch_proc_t evaluate_batch;
 } gs_function_procs_t;
 typedef struct gs_function_head_s {
     gs_function_type_t type;
@@ -186,6 +192,13 @@ int alloc_function_array(uint count, gs_function_t *** pFunctions,
 #define gs_function_evaluate(pfn, in, out)\
   ((pfn)->head.procs.evaluate)(pfn, in, out)
 
+/*
+ * Evaluate a function at count points.  in holds count groups of m
+ * input values, out receives count groups of n output values.
+ */
+#define gs_function_evaluate_batch(pfn, count, in, out)\
+  ((pfn)->head.procs.evaluate_batch)(pfn, count, in, out)
+
 /*
  * Test whether a function is monotonic on a given (closed) interval.
  * return 1 = monotonic, 0 = not or don't know, <0 = error..
@@ -34,6 +34,15 @@
 
 #define MAX_FAST_COMPS 8
 
+/*
+ * Decoded samples are kept as floats, which represent up to 24 bits
+ * exactly, for functions of at most SD_SAMPLES_MAX sample values.
+ */
+#define SD_SAMPLES_MAX_BPS 24
+#define SD_SAMPLES_MAX (1L << 20)
+/* The maximal number of inputs for fn_Sd_evaluate_batch. */
+#define SD_BATCH_MAX_M 4
+
 typedef struct gs_function_Sd_s {
     gs_function_head_t head;
     gs_function_Sd_params_t params;
@@ -44,7 +53,7 @@ private_st_function_Sd();
 static
 ENUM_PTRS_WITH(function_Sd_enum_ptrs, gs_function_Sd_t *pfn)
 {
-    index -= 6;
+    index -= 7;
     if (index < st_data_source_max_ptrs)
         return ENUM_USING(st_data_source, &pfn->params.DataSource,
                           sizeof(pfn->params.DataSource), index);
@@ -52,6 +61,7 @@ ENUM_PTRS_WITH(function_Sd_enum_ptrs, gs_function_Sd_t *pfn)
 }
 ENUM_PTR3(0, gs_function_Sd_t, params.Encode, params.Decode, params.Size);
 ENUM_PTR3(3, gs_function_Sd_t, params.pole, params.array_step, params.stream_step);
+ENUM_PTR(6, gs_function_Sd_t, params.samples);
 ENUM_PTRS_END
 static
 RELOC_PTRS_WITH(function_Sd_reloc_ptrs, gs_function_Sd_t *pfn)
@@ -61,6 +71,7 @@ RELOC_PTRS_WITH(function_Sd_reloc_ptrs, gs_function_Sd_t *pfn)
                 sizeof(pfn->params.DataSource));
     RELOC_PTR3(gs_function_Sd_t, params.Encode, params.Decode, params.Size);
     RELOC_PTR3(gs_function_Sd_t, params.pole, params.array_step, params.stream_step);
+    RELOC_PTR(gs_function_Sd_t, params.samples);
 }
 RELOC_PTRS_END
 
@@ -178,6 +189,69 @@ static int (*const fn_get_samples[]) (const gs_function_Sd_t * pfn,
         fn_gets_32
 };
 
+/*
+ * Decode all samples on the first use.  The PostScript side fills in the
+ * data after building the function, and functions that are never
+ * evaluated shouldn't pay for the memory, so this can't be done earlier.
+ */
+static int
+fn_Sd_load_samples(const gs_function_Sd_t *pfn)
+{
+    gs_function_Sd_params_t *params = (gs_function_Sd_params_t *)&pfn->params;
+    int bps = params->BitsPerSample, n = params->n;
+    uint sdata[max_Sd_n];
+    float *p;
+    long k;
+    ulong offset;
+    int j, code;
+
+    if (params->samples_loaded || params->samples_count == 0)
+        return 0;
+    p = (float *)gs_alloc_byte_array(params->samples_memory,
+                                     params->samples_count, sizeof(float),
+                                     "fn_Sd_load_samples");
+    if (p == NULL) {
+        /* Without memory, we'll read the data source every time. */
+        params->samples_count = 0;
+        return 0;
+    }
+    params->samples = p;
+    for (k = 0, offset = 0; k < params->samples_count; k += n, offset += bps * n) {
+        code = (*fn_get_samples[bps])(pfn, offset, sdata);
+        if (code < 0) {
+            gs_free_object(params->samples_memory, params->samples,
+                           "fn_Sd_load_samples");
+            params->samples = NULL;
+            return code;
+        }
+        for (j = 0; j < n; j++)
+            *p++ = (float)sdata[j];
+    }
+    params->samples_loaded = true;
+    return 0;
+}
+
+/* Get one set of sample values as floats. */
+static inline void
+fn_Sd_get_float_samples(const gs_function_Sd_t *pfn, ulong offset, float *samples)
+{
+    int j;
+
+    if (pfn->params.samples_loaded) {
+        const float *p = pfn->params.samples +
+                         offset / pfn->params.BitsPerSample;
+
+        for (j = pfn->params.n - 1; j >= 0; --j)
+            samples[j] = p[j];
+    } else {
+        uint sdata[max_Sd_n];
+
+        (*fn_get_samples[pfn->params.BitsPerSample])(pfn, offset, sdata);
+        for (j = pfn->params.n - 1; j >= 0; --j)
+            samples[j] = (float)sdata[j];
+    }
+}
+
 /*
  * Compute a value by cubic interpolation.
  * f[] = f(0), f(1), f(2), f(3); 1 < x < 2.
@@ -233,13 +307,9 @@ fn_interpolate_cubic(const gs_function_Sd_t *pfn, const float *fparts,
     int j;
 
 top:
-    if (m == 0) {
-        uint sdata[max_Sd_n];
-
-        (*fn_get_samples[pfn->params.BitsPerSample])(pfn, offset, sdata);
-        for (j = pfn->params.n - 1; j >= 0; --j)
-            samples[j] = (float)sdata[j];
-    } else {
+    if (m == 0)
+        fn_Sd_get_float_samples(pfn, offset, samples);
+    else {
         float fpart = *fparts++;
         int ipart = *iparts++;
         ulong delta = *factors++;
@@ -303,13 +373,9 @@ fn_interpolate_linear(const gs_function_Sd_t *pfn, const float *fparts,
     int j;
 
 top:
-    if (m == 0) {
-        uint sdata[max_Sd_n];
-
-        (*fn_get_samples[pfn->params.BitsPerSample])(pfn, offset, sdata);
-        for (j = pfn->params.n - 1; j >= 0; --j)
-            samples[j] = (float)sdata[j];
-    } else {
+    if (m == 0)
+        fn_Sd_get_float_samples(pfn, offset, samples);
+    else {
         float fpart = *fparts++;
         float samples1[max_Sd_n];
 
@@ -353,21 +419,16 @@ fn_Sd_encode(const gs_function_Sd_t *pfn, int i, double sample)
     return value;
 }
 
-/* Evaluate a Sampled function. */
-/* A generic algorithm with a recursion by dimentions. */
-static int
-fn_Sd_evaluate_general(const gs_function_t * pfn_common, const float *in, float *out)
+/*
+ * Encode the input values, and compute the bit offset of the base sample,
+ * the sample steps by dimensions, and the fractions to interpolate with.
+ */
+static inline ulong
+fn_Sd_locate(const gs_function_Sd_t *pfn, const float *in, float *encoded,
+             int *iparts, ulong *factors)
 {
-    const gs_function_Sd_t *pfn = (const gs_function_Sd_t *)pfn_common;
-    int bps = pfn->params.BitsPerSample;
     ulong offset = 0;
     int i;
-    float encoded[max_Sd_m];
-    int iparts[max_Sd_m];	/* only needed for cubic interpolation */
-    ulong factors[max_Sd_m];
-    float samples[max_Sd_n];
-
-    /* Encode the input values. */
 
     for (i = 0; i < pfn->params.m; ++i) {
         float d0 = pfn->params.Domain[2 * i],
@@ -395,11 +456,8 @@ fn_Sd_evaluate_general(const gs_function_t * pfn_common, const float *in, float
             encoded[i] = (arg - d0) * (pfn->params.Size[i] - 1) / (d1 - d0);
         }
     }
-
-    /* Look up and interpolate the output values. */
-
     {
-        ulong factor = bps * pfn->params.n;
+        ulong factor = pfn->params.BitsPerSample * pfn->params.n;
 
         for (i = 0; i < pfn->params.m; factor *= pfn->params.Size[i++]) {
             int ipart = (int)encoded[i];
@@ -409,6 +467,25 @@ fn_Sd_evaluate_general(const gs_function_t * pfn_common, const float *in, float
             encoded[i] -= ipart;
         }
     }
+    return offset;
+}
+
+/* Evaluate a Sampled function. */
+/* A generic algorithm with a recursion by dimentions. */
+static int
+fn_Sd_evaluate_general(const gs_function_t * pfn_common, const float *in, float *out)
+{
+    const gs_function_Sd_t *pfn = (const gs_function_Sd_t *)pfn_common;
+    ulong offset;
+    int i;
+    float encoded[max_Sd_m];
+    int iparts[max_Sd_m];	/* only needed for cubic interpolation */
+    ulong factors[max_Sd_m];
+    float samples[max_Sd_n];
+
+    /* Look up and interpolate the output values. */
+
+    offset = fn_Sd_locate(pfn, in, encoded, iparts, factors);
     if (pfn->params.Order == 3)
         fn_interpolate_cubic(pfn, encoded, iparts, factors, samples,
                              offset, pfn->params.m);
@@ -424,6 +501,73 @@ fn_Sd_evaluate_general(const gs_function_t * pfn_common, const float *in, float
     return 0;
 }
 
+/* Evaluate a Sampled function at several points. */
+/* Multilinear interpolation over the decoded samples. */
+static int
+fn_Sd_evaluate_batch(const gs_function_t * pfn_common, int count,
+                     const float *in, float *out)
+{
+    const gs_function_Sd_t *pfn = (const gs_function_Sd_t *)pfn_common;
+    int m = pfn->params.m, n = pfn->params.n;
+    int bps = pfn->params.BitsPerSample;
+    float encoded[max_Sd_m];
+    int iparts[max_Sd_m];
+    ulong factors[max_Sd_m];
+    float v[(1 << SD_BATCH_MAX_M) * max_Sd_n];
+    int k;
+
+    int code = fn_Sd_load_samples(pfn);
+
+    if (code < 0)
+        return code;
+    if (pfn->params.Order != 1 || !pfn->params.samples_loaded ||
+        m > SD_BATCH_MAX_M)
+        return gs_function_evaluate_batch_default(pfn_common, count, in, out);
+    for (k = 0; k < count; k++, in += m, out += n) {
+        const float *base = pfn->params.samples +
+                    fn_Sd_locate(pfn, in, encoded, iparts, factors) / bps;
+        ulong step[SD_BATCH_MAX_M];
+        float f[SD_BATCH_MAX_M];
+        int a = 0, corners, c, i, j;
+
+        /* Skip the dimensions with a zero fraction, as
+           fn_interpolate_linear does. */
+        for (i = 0; i < m; i++)
+            if (!is_fzero(encoded[i])) {
+                step[a] = factors[i] / bps;
+                f[a++] = encoded[i];
+            }
+        /* Load the corners; the first dimension is the high bit. */
+        corners = 1 << a;
+        for (c = 0; c < corners; c++) {
+            const float *p = base;
+
+            for (i = 0; i < a; i++)
+                if (c & (1 << (a - 1 - i)))
+                    p += step[i];
+            for (j = 0; j < n; j++)
+                v[c * n + j] = p[j];
+        }
+        /* Interpolate by the last dimension first, so that the result
+           is exactly the one of fn_Sd_evaluate_general. */
+        for (i = a - 1; i >= 0; i--) {
+            float fi = f[i];
+
+            corners >>= 1;
+            for (c = 0; c < corners; c++) {
+                const float *v0 = v + 2 * c * n, *v1 = v0 + n;
+                float *d = v + c * n;
+
+                for (j = 0; j < n; j++)
+                    d[j] = v0[j] + (v1[j] - v0[j]) * fi;
+            }
+        }
+        for (j = 0; j < n; j++)
+            out[j] = (float)fn_Sd_encode(pfn, j, v[j]);
+    }
+    return 0;
+}
+
 static const double double_stub = 1e90;
 
 static inline void
@@ -570,6 +714,14 @@ load_vector_to(const gs_function_Sd_t *pfn, int s_offset, double *V)
     uint sdata[max_Sd_n];
     int k, code;
 
+    if (pfn->params.samples_loaded) {
+        const float *p = pfn->params.samples +
+                         s_offset / pfn->params.BitsPerSample;
+
+        for (k = 0; k < pfn->params.n; k++)
+            V[k] = fn_Sd_encode(pfn, k, (double)p[k]);
+        return 0;
+    }
     code = fn_get_samples[pfn->params.BitsPerSample](pfn, s_offset, sdata);
     if (code < 0)
         return code;
@@ -585,6 +737,14 @@ load_vector(const gs_function_Sd_t *pfn, int a_offset, int s_offset)
         uint sdata[max_Sd_n];
         int k, code;
 
+        if (pfn->params.samples_loaded) {
+            const float *p = pfn->params.samples +
+                             s_offset / pfn->params.BitsPerSample;
+
+            for (k = 0; k < pfn->params.n; k++)
+                *(pfn->params.pole + a_offset + k) = fn_Sd_encode(pfn, k, (double)p[k]);
+            return 0;
+        }
         code = fn_get_samples[pfn->params.BitsPerSample](pfn, s_offset, sdata);
         if (code < 0)
             return code;
@@ -823,8 +983,10 @@ static int
 fn_Sd_evaluate(const gs_function_t * pfn_common, const float *in, float *out)
 {
     const gs_function_Sd_t *pfn = (const gs_function_Sd_t *)pfn_common;
-    int code;
+    int code = fn_Sd_load_samples(pfn);
 
+    if (code < 0)
+        return code;
     if (pfn->params.Order == 3) {
         if (POLE_CACHE_GENERIC_1D || pfn->params.m > 1)
             code = fn_Sd_evaluate_multicubic_cached(pfn, in, out);
@@ -1327,6 +1489,31 @@ fn_Sd_get_params(const gs_function_t *pfn_common, gs_param_list *plist)
     return ecode;
 }
 
+/*
+ * Set up the decoded samples, unless they are too many or too long.
+ * They are allocated by fn_Sd_load_samples, from stable memory, since
+ * that may happen after a save.
+ */
+static void
+fn_Sd_init_samples(gs_function_Sd_params_t *params, gs_memory_t *mem)
+{
+    long count = params->n;
+    int i;
+
+    params->samples = NULL;
+    params->samples_loaded = false;
+    params->samples_count = 0;
+    params->samples_memory = gs_memory_stable(mem);
+    if (params->BitsPerSample > SD_SAMPLES_MAX_BPS)
+        return;
+    for (i = 0; i < params->m; ++i) {
+        if (params->Size[i] > SD_SAMPLES_MAX / count)
+            return;
+        count *= params->Size[i];
+    }
+    params->samples_count = count;
+}
+
 /* Make a scaled copy of a Sampled function. */
 static int
 fn_Sd_make_scaled(const gs_function_Sd_t *pfn, gs_function_Sd_t **ppsfn,
@@ -1342,6 +1529,7 @@ fn_Sd_make_scaled(const gs_function_Sd_t *pfn, gs_function_Sd_t **ppsfn,
     psfn->params = pfn->params;
     psfn->params.Encode = 0;		/* in case of failure */
     psfn->params.Decode = 0;
+    fn_Sd_init_samples(&psfn->params, mem);
     psfn->params.Size =
         fn_copy_values(pfn->params.Size, pfn->params.m, sizeof(int), mem);
     if ((code = (psfn->params.Size == 0 ?
@@ -1370,6 +1558,9 @@ gs_function_Sd_free_params(gs_function_Sd_params_t * params, gs_memory_t * mem)
     gs_free_object(mem, params->pole, "gs_function_Sd_free_params");
     gs_free_object(mem, params->array_step, "gs_function_Sd_free_params");
     gs_free_object(mem, params->stream_step, "gs_function_Sd_free_params");
+    if (params->samples != NULL)
+        gs_free_object(params->samples_memory, params->samples,
+                       "gs_function_Sd_free_params");
 }
 
 /* aA helper for gs_function_Sd_serialize. */
@@ -1446,6 +1637,7 @@ gs_function_Sd_init(gs_function_t ** ppfn,
             (fn_free_params_proc_t) gs_function_Sd_free_params,
             fn_common_free,
             (fn_serialize_proc_t) gs_function_Sd_serialize,
+            (fn_evaluate_batch_proc_t) fn_Sd_evaluate_batch,
         }
     };
     int code;
@@ -1496,6 +1688,7 @@ gs_function_Sd_init(gs_function_t ** ppfn,
         pfn->params.pole = NULL;
         pfn->params.array_step = NULL;
         pfn->params.stream_step = NULL;
+        fn_Sd_init_samples(&pfn->params, mem);
         pfn->head = function_Sd_head;
         pfn->params.array_size = 0;
         if (pfn->params.m == 1 && pfn->params.Order == 1 && pfn->params.n <= MAX_FAST_COMPS && !DEBUG_Sd_1arg) {
@@ -40,6 +40,10 @@ typedef struct gs_function_Sd_params_s {
     int *array_step;		/* pole array element step by dimensions */
     int *stream_step;		/* sample stream element step by dimensions */
     int array_size;		/* The number of elements in the pole array. */
+    float *samples;		/* decoded samples (internal data), or NULL */
+    bool samples_loaded;	/* samples are filled in (internal data) */
+    long samples_count;		/* # of sample values to cache, 0 = none */
+    gs_memory_t *samples_memory;	/* allocator for samples */
 } gs_function_Sd_params_t;
 
 #define private_st_function_Sd()	/* in gsfunc.c */\
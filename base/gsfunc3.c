@@ -246,6 +246,7 @@ gs_function_ElIn_init(gs_function_t ** ppfn,
             (fn_free_params_proc_t) gs_function_ElIn_free_params,
             fn_common_free,
             (fn_serialize_proc_t) gs_function_ElIn_serialize,
+            gs_function_evaluate_batch_default,
         }
     };
     int code;
@@ -517,6 +518,7 @@ gs_function_1ItSg_init(gs_function_t ** ppfn,
             (fn_free_params_proc_t) gs_function_1ItSg_free_params,
             fn_common_free,
             (fn_serialize_proc_t) gs_function_1ItSg_serialize,
+            gs_function_evaluate_batch_default,
         }
     };
     int n = (params->Range == 0 ? 0 : params->n);
@@ -699,6 +701,7 @@ gs_function_AdOt_init(gs_function_t ** ppfn,
             (fn_free_params_proc_t) gs_function_AdOt_free_params,
             fn_common_free,
             (fn_serialize_proc_t) gs_function_AdOt_serialize,
+            gs_function_evaluate_batch_default,
         }
     };
     int m = params->m, n = params->n;
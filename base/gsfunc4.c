@@ -821,6 +821,7 @@ gs_function_PtCr_init(gs_function_t ** ppfn,
             (fn_free_params_proc_t) gs_function_PtCr_free_params,
             fn_common_free,
             (fn_serialize_proc_t) gs_function_PtCr_serialize,
+            gs_function_evaluate_batch_default,
         }
     };
     int code;
@@ -31,6 +31,7 @@
 #include "gsicc_cache.h"
 #include "gsicc_manage.h"
 #include "gsicc_profilecache.h"
+#include "gxcpcache.h"
 
 /******************************************************************************
  * See gsstate.c for a discussion of graphics/imager state memory management. *
@@ -72,7 +73,8 @@ ENUM_PTRS_BEGIN(imager_state_enum_ptrs)
     ENUM_PTR(3, gs_imager_state, icc_manager);
     ENUM_PTR(4, gs_imager_state, icc_link_cache);
     ENUM_PTR(5, gs_imager_state, icc_profile_cache);
-#define E1(i,elt) ENUM_PTR(i+6,gs_imager_state,elt);
+    ENUM_PTR(6, gs_imager_state, clip_cache);
+#define E1(i,elt) ENUM_PTR(i+7,gs_imager_state,elt);
     gs_cr_state_do_ptrs(E1)
 #undef E1
 ENUM_PTRS_END
@@ -85,6 +87,7 @@ static RELOC_PTRS_BEGIN(imager_state_reloc_ptrs)
     RELOC_PTR(gs_imager_state, icc_manager);
     RELOC_PTR(gs_imager_state, icc_link_cache);
     RELOC_PTR(gs_imager_state, icc_profile_cache);
+    RELOC_PTR(gs_imager_state, clip_cache);
 #define R1(i,elt) RELOC_PTR(gs_imager_state,elt);
     gs_cr_state_do_ptrs(R1)
 #undef R1
@@ -142,6 +145,7 @@ gs_imager_state_initialize(gs_imager_state * pis, gs_memory_t * mem)
     pis->icc_link_cache = gsicc_cache_new(pis->memory);
     pis->icc_manager = gsicc_manager_new(pis->memory);
     pis->icc_profile_cache = gsicc_profilecache_new(pis->memory);
+    pis->clip_cache = gx_clip_cache_new(pis->memory);
     return 0;
 }
 
@@ -184,6 +188,7 @@ gs_imager_state_copied(gs_imager_state * pis)
     rc_increment(pis->icc_link_cache);
     rc_increment(pis->icc_profile_cache);
     rc_increment(pis->icc_manager);
+    rc_increment(pis->clip_cache);
 }
 
 /* Adjust reference counts before assigning one imager state to another. */
@@ -211,6 +216,7 @@ gs_imager_state_pre_assign(gs_imager_state *pto, const gs_imager_state *pfrom)
     RCCOPY(icc_link_cache);
     RCCOPY(icc_profile_cache);
     RCCOPY(icc_manager);
+    RCCOPY(clip_cache);
 #undef RCCOPY
 }
 
@@ -247,5 +253,6 @@ gs_imager_state_release(gs_imager_state * pis)
     RCDECR(icc_link_cache);
     RCDECR(icc_profile_cache);
     RCDECR(icc_manager);
+    RCDECR(clip_cache);
 #undef RCDECR
 }
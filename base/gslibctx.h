@@ -68,6 +68,18 @@ typedef struct gs_lib_ctx_s
      * state, but this can't be done due to problems detecting changes in it
      * for the clist based devices. */
     bool CPSI_mode;
+    /* Paths with at least this many segments are filled by coverage
+     * accumulation when possible, 0 = never (CoverageFill user parameter,
+     * see gxfillcv.c).  Kept here rather than in the imager state for the
+     * same reason as CPSI_mode. */
+    int coverage_fill;
+    /* The number of threads for filling huge paths by coverage
+     * accumulation (FillThreads user parameter, see gxfillcv.c).  Only
+     * used if coverage_fill is non-zero. */
+    int fill_threads;
+    /* The number of threads for decoding a JPEG image (DCTDecodeThreads
+     * system parameter, see sdctd.c). */
+    int dct_decode_threads;
     /* Keep the path for the ICCProfiles here so devices and the icc_manager 
      * can get to it. Prevents needing two copies, one in the icc_manager
      * and one in the device */
@@ -27,6 +27,7 @@
 #include "gscoord.h"            /* for gs_initmatrix */
 #include "gscie.h"
 #include "gxclipsr.h"
+#include "gxcpcache.h"
 #include "gxcmap.h"
 #include "gxdevice.h"
 #include "gxpcache.h"
@@ -462,6 +463,8 @@ gs_grestoreall_for_restore(gs_state * pgs, gs_state * saved)
     /* Make sure we don't leave dangling pointers in the caches. */
     if (pgs->pattern_cache)
         (*pgs->pattern_cache->free_all) (pgs->pattern_cache);
+    if (pgs->clip_cache)
+        gx_clip_cache_free_all(pgs->clip_cache);
     pgs->saved->saved = saved;
     code = gs_grestore(pgs);
     if (code < 0)
@@ -734,6 +737,57 @@ gs_currentcpsimode(const gs_memory_t * mem)
     return libctx->CPSI_mode;
 }
 
+void
+gs_setcoveragefill(gs_memory_t *mem, int min_segments)
+{
+    gs_lib_ctx_t *libctx = gs_lib_ctx_get_interp_instance(mem);
+
+    libctx->coverage_fill = min_segments;
+}
+
+/* currentcoveragefill */
+int
+gs_currentcoveragefill(const gs_memory_t * mem)
+{
+    gs_lib_ctx_t *libctx = gs_lib_ctx_get_interp_instance(mem);
+
+    return libctx->coverage_fill;
+}
+
+void
+gs_setfillthreads(gs_memory_t *mem, int threads)
+{
+    gs_lib_ctx_t *libctx = gs_lib_ctx_get_interp_instance(mem);
+
+    libctx->fill_threads = threads;
+}
+
+/* currentfillthreads */
+int
+gs_currentfillthreads(const gs_memory_t * mem)
+{
+    gs_lib_ctx_t *libctx = gs_lib_ctx_get_interp_instance(mem);
+
+    return libctx->fill_threads;
+}
+
+void
+gs_setdctdecodethreads(gs_memory_t *mem, int threads)
+{
+    gs_lib_ctx_t *libctx = gs_lib_ctx_get_interp_instance(mem);
+
+    libctx->dct_decode_threads = threads;
+}
+
+/* currentdctdecodethreads */
+int
+gs_currentdctdecodethreads(const gs_memory_t * mem)
+{
+    gs_lib_ctx_t *libctx = gs_lib_ctx_get_interp_instance(mem);
+
+    return libctx->dct_decode_threads;
+}
+
 /* setrenderingintent
  *
  *  Use ICC numbers from Table 18 (section 6.1.11) rather than the PDF order
@@ -61,6 +61,12 @@ int gs_initgraphics(gs_state *);
 
 bool gs_currentcpsimode(const gs_memory_t *);
 void gs_setcpsimode(gs_memory_t *, bool);
+int gs_currentcoveragefill(const gs_memory_t *);
+void gs_setcoveragefill(gs_memory_t *, int);
+int gs_currentfillthreads(const gs_memory_t *);
+void gs_setfillthreads(gs_memory_t *, int);
+int gs_currentdctdecodethreads(const gs_memory_t *);
+void gs_setdctdecodethreads(gs_memory_t *, int);
 
 /* Device control */
 #include "gsdevice.h"
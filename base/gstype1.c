@@ -149,8 +149,7 @@ gs_type1_interpret(gs_type1_state * pcis, const gs_glyph_data_t *pgd,
                             gs_currentaligntopixels(pfont->dir));
             if (code < 0)
                 return code;
-            code = t1_hinter__set_font_data(h, 1, pdata, pcis->no_grid_fitting,
-                            pcis->pfont->is_resource);
+            code = t1_hinter__set_font_data(h, 1, pfont, pcis->no_grid_fitting);
             if (code < 0)
                 return code;
             break;
@@ -524,6 +523,7 @@ rsbw:		/* Give the caller the opportunity to intervene. */
                                 )
                                 return_error(gs_error_invalidfont);
                             n = fixed2int_var(csp[-1]);
+                            pdata->client_OtherSubrs = true;
                             code = (*pdata->procs.push_values)
                                 (pcis->callback_data, csp - (n + 1), n);
                             if (code < 0)
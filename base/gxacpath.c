@@ -30,6 +30,7 @@
 #include "gzcpath.h"
 #include "gzacpath.h"
 #include "gxdevsop.h"
+#include "gxcpcache.h"
 
 /* Device procedures */
 static dev_proc_open_device(accum_open_device);
@@ -203,6 +204,218 @@ gx_cpath_accum_discard(gx_device_cpath_accum * padev)
     gx_clip_list_free(&padev->list, padev->list_memory);
 }
 
+/* ------ Intersection cache ------ */
+
+static
+ENUM_PTRS_WITH(clip_cache_enum_ptrs, gx_clip_cache *pcc)
+    if (index >= CLIP_CACHE_SIZE * 2)
+        return 0;
+    if (index & 1)
+        return ENUM_OBJ(pcc->entries[index >> 1].rect_list);
+    return ENUM_OBJ(pcc->entries[index >> 1].path);
+ENUM_PTRS_END
+static
+RELOC_PTRS_WITH(clip_cache_reloc_ptrs, gx_clip_cache *pcc)
+{
+    int i;
+
+    for (i = 0; i < CLIP_CACHE_SIZE; ++i) {
+        RELOC_VAR(pcc->entries[i].path);
+        RELOC_VAR(pcc->entries[i].rect_list);
+    }
+} RELOC_PTRS_END
+gs_private_st_composite(st_clip_cache, gx_clip_cache, "gx_clip_cache",
+                        clip_cache_enum_ptrs, clip_cache_reloc_ptrs);
+
+static void
+clip_cache_entry_free(gx_clip_cache *pcc, gx_clip_cache_entry *pce)
+{
+    if (pce->in_id == gs_no_id)
+        return;
+    rc_decrement(pce->rect_list, "clip_cache_entry_free");
+    gs_free_object(pcc->memory, pce->path, "clip_cache_entry_free");
+    pce->rect_list = 0;
+    pce->path = 0;
+    pce->in_id = gs_no_id;
+}
+
+static void
+rc_free_clip_cache(gs_memory_t * mem, void *vpcc, client_name_t cname)
+{
+    gx_clip_cache *pcc = (gx_clip_cache *)vpcc;
+
+    gx_clip_cache_free_all(pcc);
+    gs_free_object(mem, pcc, cname);
+}
+
+/* Allocate a clip path intersection cache. */
+gx_clip_cache *
+gx_clip_cache_new(gs_memory_t * mem)
+{
+    gs_memory_t *stable_mem = gs_memory_stable(mem);
+    gx_clip_cache *pcc;
+    int i;
+
+    rc_alloc_struct_1(pcc, gx_clip_cache, &st_clip_cache, stable_mem,
+                      return 0, "gx_clip_cache_new");
+    pcc->rc.free = rc_free_clip_cache;
+    pcc->memory = stable_mem;
+    pcc->use_count = 0;
+    for (i = 0; i < CLIP_CACHE_SIZE; ++i) {
+        pcc->entries[i].in_id = gs_no_id;
+        pcc->entries[i].path = 0;
+        pcc->entries[i].rect_list = 0;
+    }
+    return pcc;
+}
+
+/* Empty a clip path intersection cache. */
+void
+gx_clip_cache_free_all(gx_clip_cache * pcc)
+{
+    int i;
+
+    for (i = 0; i < CLIP_CACHE_SIZE; ++i)
+        clip_cache_entry_free(pcc, &pcc->entries[i]);
+}
+
+/*
+ * Walk the segments of a path as a sequence of fixed values, computing
+ * their hash.  If data is not 0, store the values into it, or compare them
+ * with it if compare is true.  Return the number of values, or -1 if the
+ * comparison fails or the path is too long to cache.
+ */
+static int
+clip_cache_walk_path(const gx_path * ppath, fixed * data, bool compare,
+                     uint * phash)
+{
+    const segment *pseg = (const segment *)ppath->first_subpath;
+    uint hash = 0;
+    int size = 0;
+
+#define PUT_VALUE(v)\
+  BEGIN\
+    fixed v_ = (v);\
+\
+    if (size >= CLIP_CACHE_MAX_PATH)\
+        return -1;\
+    if (data != 0) {\
+        if (!compare)\
+            data[size] = v_;\
+        else if (data[size] != v_)\
+            return -1;\
+    }\
+    hash = hash * 31 + (uint)v_;\
+    ++size;\
+  END
+    for (; pseg != 0; pseg = pseg->next) {
+        PUT_VALUE((pseg->type << 16) + pseg->notes);
+        if (pseg->type == s_curve) {
+            const curve_segment *pc = (const curve_segment *)pseg;
+
+            PUT_VALUE(pc->p1.x);
+            PUT_VALUE(pc->p1.y);
+            PUT_VALUE(pc->p2.x);
+            PUT_VALUE(pc->p2.y);
+        }
+        PUT_VALUE(pseg->pt.x);
+        PUT_VALUE(pseg->pt.y);
+    }
+#undef PUT_VALUE
+    *phash = hash;
+    return size;
+}
+
+/* Look up an intersection in the cache. */
+static gx_clip_cache_entry *
+clip_cache_lookup(gx_clip_cache *pcc, gs_id in_id,
+                  const gx_fill_params * params, const gx_path * ppath,
+                  int size, uint hash)
+{
+    int i;
+
+    for (i = 0; i < CLIP_CACHE_SIZE; ++i) {
+        gx_clip_cache_entry *pce = &pcc->entries[i];
+        uint ignore_hash;
+
+        if (pce->in_id == in_id && pce->size == size && pce->hash == hash &&
+            pce->rule == params->rule &&
+            pce->adjust.x == params->adjust.x &&
+            pce->adjust.y == params->adjust.y &&
+            pce->flatness == params->flatness &&
+            clip_cache_walk_path(ppath, pce->path, true, &ignore_hash) == size
+            ) {
+            pce->last_used = ++(pcc->use_count);
+            return pce;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Remember the intersection just stored into pcpath.  Only lists allocated
+ * in the same memory as the cache (normally, those of the graphics state's
+ * clipping paths) are cached, so that they are covered by the flush before
+ * a restore.  Failure to cache is not an error.
+ */
+static void
+clip_cache_add(gx_clip_cache *pcc, gs_id in_id,
+               const gx_fill_params * params, const gx_path * ppath,
+               int size, uint hash, const gx_clip_path * pcpath)
+{
+    gx_clip_rect_list *rlist = pcpath->rect_list;
+    gx_clip_cache_entry *pce = &pcc->entries[0];
+    uint ignore_hash;
+    fixed *data;
+    int i;
+
+    if (size == 0 || rlist == &pcpath->local_list ||
+        gs_memory_stable(rlist->rc.memory) != pcc->memory)
+        return;
+    for (i = 1; i < CLIP_CACHE_SIZE && pce->in_id != gs_no_id; ++i)
+        if (pcc->entries[i].in_id == gs_no_id ||
+            pcc->entries[i].last_used < pce->last_used)
+            pce = &pcc->entries[i];
+    clip_cache_entry_free(pcc, pce);
+    data = (fixed *)gs_alloc_byte_array(pcc->memory, size, sizeof(fixed),
+                                        "clip_cache_add");
+    if (data == 0)
+        return;
+    clip_cache_walk_path(ppath, data, false, &ignore_hash);
+    pce->in_id = in_id;
+    pce->rule = params->rule;
+    pce->adjust = params->adjust;
+    pce->flatness = params->flatness;
+    pce->hash = hash;
+    pce->size = size;
+    pce->path = data;
+    pce->rect_list = rlist;
+    rc_increment(rlist);
+    pce->bbox = pcpath->path.bbox;
+    pce->inner_box = pcpath->inner_box;
+    pce->outer_box = pcpath->outer_box;
+    pce->id = pcpath->id;
+    pce->last_used = ++(pcc->use_count);
+}
+
+/* Install a cached intersection, as gx_cpath_accum_end would. */
+static void
+clip_cache_install(const gx_clip_cache_entry *pce, gx_clip_path * pcpath)
+{
+    gx_clip_path apath;
+
+    gx_cpath_init_local(&apath, pcpath->path.memory);
+    apath.rect_list = pce->rect_list;
+    rc_increment(apath.rect_list);
+    apath.path.bbox = pce->bbox;
+    apath.path.bbox_accurate = 1;
+    apath.inner_box = pce->inner_box;
+    apath.outer_box = pce->outer_box;
+    apath.path_valid = false;
+    apath.id = pce->id;
+    gx_cpath_assign_free(pcpath, &apath);
+}
+
 /* Intersect two clipping paths using an accumulator. */
 int
 gx_cpath_intersect_path_slow(gx_clip_path * pcpath, gx_path * ppath,
@@ -210,14 +423,15 @@ gx_cpath_intersect_path_slow(gx_clip_path * pcpath, gx_path * ppath,
                              const gx_fill_params * params0)
 {
     gs_logical_operation_t save_lop = gs_current_logical_op_inline(pis);
+    gx_clip_cache *pcc = pis->clip_cache;
+    gs_id in_id = pcpath->id;
     gx_device_cpath_accum adev;
     gx_device_color devc;
     gx_fill_params params;
+    int size = -1;
+    uint hash;
     int code;
 
-    gx_cpath_accum_begin(&adev, pcpath->path.memory);
-    set_nonclient_dev_color(&devc, 0);	/* arbitrary, but not transparent */
-    gs_set_logical_op_inline(pis, lop_default);
     if (params0 != 0)
         params = *params0;
     else {
@@ -228,10 +442,27 @@ gx_cpath_intersect_path_slow(gx_clip_path * pcpath, gx_path * ppath,
         params.adjust.y = float2fixed(fadjust.y);
         params.flatness = gs_currentflat_inline(pis);
     }
+    if (pcc != 0 && in_id != gs_no_id) {
+        const gx_clip_cache_entry *pce;
+
+        size = clip_cache_walk_path(ppath, NULL, false, &hash);
+        if (size >= 0 &&
+            (pce = clip_cache_lookup(pcc, in_id, &params, ppath,
+                                     size, hash)) != 0
+            ) {
+            clip_cache_install(pce, pcpath);
+            return 0;
+        }
+    }
+    gx_cpath_accum_begin(&adev, pcpath->path.memory);
+    set_nonclient_dev_color(&devc, 0);	/* arbitrary, but not transparent */
+    gs_set_logical_op_inline(pis, lop_default);
     code = gx_fill_path_only(ppath, (gx_device *)&adev, pis,
                              &params, &devc, pcpath);
     if (code < 0 || (code = gx_cpath_accum_end(&adev, pcpath)) < 0)
         gx_cpath_accum_discard(&adev);
+    else if (size >= 0)
+        clip_cache_add(pcc, in_id, &params, ppath, size, hash, pcpath);
     gs_set_logical_op_inline(pis, save_lop);
     return code;
 }
@@ -159,15 +159,34 @@ gx_lookup_cached_char(const gs_font * pfont, const cached_fm_pair * pair,
             ) {
             if_debug4('K', "[K]found 0x%lx (depth=%d) for glyph=0x%lx, wmode=%d\n",
                       (ulong) cc, cc_depth(cc), (ulong) glyph, wmode);
-            return cc;
+            dir->ccache.hits++;
+            return gx_touch_cached_char(dir, cc);
         }
         chi++;
     }
     if_debug3('K', "[K]not found: glyph=0x%lx, wmode=%d, depth=%d\n",
               (ulong) glyph, wmode, depth);
+    dir->ccache.misses++;
     return 0;
 }
 
+/* Check whether a glyph is in the cache at any depth or origin. */
+/* This doesn't count as a lookup : it is for looking ahead in the text. */
+bool
+gx_char_cached(const gs_font_dir *dir, const cached_fm_pair *pair,
+               gs_glyph glyph, int wmode)
+{
+    uint chi = chars_head_index(glyph, pair);
+    const cached_char *cc;
+
+    while ((cc = dir->ccache.table[chi & dir->ccache.table_mask]) != 0) {
+        if (cc->code == glyph && cc_pair(cc) == pair && cc->wmode == wmode)
+            return true;
+        chi++;
+    }
+    return false;
+}
+
 /* Copy a cached character to the screen. */
 /* Assume the caller has already done gx_color_load. */
 /* Return 0 if OK, 1 if we couldn't do the operation but no error */
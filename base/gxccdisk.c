@@ -0,0 +1,688 @@
+/* Copyright (C) 2001-2012 Artifex Software, Inc.
+   All Rights Reserved.
+
+   This software is provided AS-IS with no warranty, either express or
+   implied.
+
+   This software is distributed under license and may not be copied,
+   modified or distributed except as expressly authorized under the terms
+   of the license contained in the file LICENSE in this distribution.
+
+   Refer to licensing information at http://www.artifex.com or contact
+   Artifex Software, Inc.,  7 Mt. Lassen Drive - Suite A-134, San Rafael,
+   CA  94903, U.S.A., +1(415)492-9861, for further information.
+*/
+
+
+/* Persistent glyph cache for Ghostscript library */
+#include "memory_.h"
+#include "gx.h"
+#include "gp.h"
+#include "md5.h"
+#include "gscdefs.h"		/* for gs_revision */
+#include "gsutil.h"		/* for gs_next_ids */
+#include "gxfixed.h"
+#include "gxmatrix.h"
+#include "gxfont.h"
+#include "gxfont1.h"
+#include "gxfont42.h"
+#include "gxfcache.h"
+#include "gxchar.h"
+
+#define U16(p) (((uint)((p)[0]) << 8) + (p)[1])
+#define u32(p) get_u32_msb(p)
+
+/*
+ * When GlyphDiskCache is set at startup, the rendered glyphs of each
+ * font/matrix pair of a Type 1, Type 2 (CFF) or TrueType font are kept
+ * in the persistent cache (gp_cache_insert / gp_cache_query) between
+ * runs, so that a process showing the same fonts as an earlier one can
+ * copy their bitmaps rather than rendering them again.
+ *
+ * Each pair has one cache item, a 'strike': it is read when the pair
+ * is created, searched when a glyph isn't in the character cache, and
+ * written back, with any glyphs rendered since, when the pair is purged
+ * or when gs_font_dir_save_glyphs is called at the end of the run.
+ *
+ * Nothing a font claims about itself, such as a UniqueID, is trusted:
+ * the cache is shared by all the jobs that enable it, and a job must
+ * not be able to make another one show bits it didn't render itself.
+ * Instead, the key of a strike includes a digest of the font data that
+ * all its glyphs depend on (the hinting parameters and Subrs of a Type 1
+ * font, the hinting tables of a TrueType font), and each glyph in the
+ * strike is identified by a digest of its own program, those of the
+ * glyphs it is built from (seac or composite pieces), and its metrics.
+ * Glyphs that depend on PostScript procedures (OtherSubrs the Type 1
+ * interpreter doesn't implement, CDevProc) are never kept.
+ * The rest of the key covers everything else that affects the bits: the
+ * FontType, the renderer, the character matrix (which includes the
+ * oversampling scale), the hinting parameters and the Ghostscript
+ * revision.  The renderers (the Type 1 hinter, FAPI) also depend on how
+ * the matrix is split between the FontMatrix and the CTM, so the
+ * FontMatrix of the scaled font that created the pair is part of the
+ * key too, and the strike is only used while showing with a font that
+ * has the same FontMatrix.  The data is in native byte order, like the
+ * rest of the persistent cache.
+ *
+ * A strike holds at most strike_max_size bytes of glyphs; glyphs are
+ * found through a hash index built when the strike is read.
+ */
+
+#define strike_max_size 0x100000
+#define strike_max_pieces 8	/* per glyph */
+#define strike_max_depth 4	/* of nested pieces */
+
+struct gx_glyph_strike_s {
+    gs_memory_t *memory;
+    byte *key;
+    uint key_size;
+    byte *data;			/* strike_char records */
+    uint size, capacity;
+    uint saved;			/* size when read or last written */
+    uint *index;		/* offset + 1 of records, 0 = empty */
+    uint index_size;		/* a power of 2, or 0 */
+    uint count;			/* # of records */
+    gs_matrix FontMatrix;	/* of the scaled font, see below */
+    /* The digest of the last glyph looked up, for adding it. */
+    gs_glyph last_glyph;
+    int last_wmode;
+    gs_md5_byte_t last_digest[16];
+};
+
+/* The key of a strike. */
+typedef struct strike_key_s {
+    char magic[4];
+    long revision;
+    int FontType;
+    int fapi;
+    int design_grid, align_to_pixels, grid_fit_tt;
+    float mxx, mxy, myx, myy;
+    float fxx, fxy, fyx, fyy;	/* FontMatrix */
+    gs_md5_byte_t font_digest[16];
+} strike_key;
+
+/* A glyph in a strike.  The bits follow. */
+typedef struct strike_char_s {
+    uint size;			/* total size of the record */
+    gs_md5_byte_t digest[16];	/* of the glyph, see above */
+    gs_fixed_point subpix_origin;
+    gs_fixed_point offset;
+    gs_fixed_point wxy;
+    ushort width, height, raster;
+    byte wmode, depth;
+} strike_char;
+
+#define strike_align align_cached_char_mod
+#define sizeof_strike_char ROUND_UP(sizeof(strike_char), strike_align)
+#define strike_char_bits(sc) ((byte *)(sc) + sizeof_strike_char)
+
+/* ------ Digests ------ */
+
+#define strike_md5_value(pmd5, v)\
+  gs_md5_append(pmd5, (const gs_md5_byte_t *)&(v), sizeof(v))
+#define strike_md5_array(pmd5, t)\
+  BEGIN\
+    strike_md5_value(pmd5, (t).count);\
+    gs_md5_append(pmd5, (const gs_md5_byte_t *)(t).values,\
+                  (t).count * sizeof((t).values[0]));\
+  END
+
+static void
+strike_md5_bytes(gs_md5_state_t *pmd5, const byte *data, uint size)
+{
+    strike_md5_value(pmd5, size);
+    gs_md5_append(pmd5, data, size);
+}
+
+/* Add the data of a glyph data structure, and free it. */
+static void
+strike_md5_glyph_data(gs_md5_state_t *pmd5, gs_glyph_data_t *pgd)
+{
+    strike_md5_bytes(pmd5, pgd->bits.data, pgd->bits.size);
+    gs_glyph_data_free(pgd, "strike_md5_glyph_data");
+}
+
+/* Add a range of a TrueType font's data. */
+static int
+strike_md5_sfnts(gs_md5_state_t *pmd5, gs_font_type42 *pfont,
+                 ulong pos, ulong length)
+{
+    strike_md5_value(pmd5, length);
+    while (length > 0) {
+        uint n = (uint)min(length, max_uint);
+        const byte *data;
+        int code = pfont->data.string_proc(pfont, pos, n, &data);
+
+        if (code < 0)
+            return code;
+        if (code > 0)
+            n = code;
+        gs_md5_append(pmd5, data, n);
+        pos += n;
+        length -= n;
+    }
+    return 0;
+}
+
+/*
+ * Compute the digest of the data that all the glyphs of a font depend on.
+ * Return 1 if the font isn't one whose glyphs we keep.
+ */
+static int
+strike_font_digest(gs_font *font, gs_md5_byte_t digest[16])
+{
+    gs_md5_state_t md5;
+    int code;
+
+    gs_md5_init(&md5);
+    strike_md5_value(&md5, font->FontType);
+    strike_md5_value(&md5, font->PaintType);
+    strike_md5_value(&md5, font->StrokeWidth);
+    switch (font->FontType) {
+        case ft_encrypted:
+        case ft_encrypted2: {
+            gs_font_type1 *const pfont = (gs_font_type1 *)font;
+            const gs_type1_data *const pdata = &pfont->data;
+            int global;
+
+            strike_md5_value(&md5, pdata->lenIV);
+            strike_md5_value(&md5, pdata->subroutineNumberBias);
+            if (font->FontType == ft_encrypted2) {
+                strike_md5_value(&md5, pdata->gsubrNumberBias);
+                strike_md5_value(&md5, pdata->initialRandomSeed);
+                strike_md5_value(&md5, pdata->defaultWidthX);
+                strike_md5_value(&md5, pdata->nominalWidthX);
+            }
+            strike_md5_value(&md5, pdata->BlueFuzz);
+            strike_md5_value(&md5, pdata->BlueScale);
+            strike_md5_value(&md5, pdata->BlueShift);
+            strike_md5_array(&md5, pdata->BlueValues);
+            strike_md5_value(&md5, pdata->ExpansionFactor);
+            strike_md5_value(&md5, pdata->ForceBold);
+            strike_md5_array(&md5, pdata->FamilyBlues);
+            strike_md5_array(&md5, pdata->FamilyOtherBlues);
+            strike_md5_value(&md5, pdata->LanguageGroup);
+            strike_md5_array(&md5, pdata->OtherBlues);
+            strike_md5_value(&md5, pdata->RndStemUp);
+            strike_md5_array(&md5, pdata->StdHW);
+            strike_md5_array(&md5, pdata->StdVW);
+            strike_md5_array(&md5, pdata->StemSnapH);
+            strike_md5_array(&md5, pdata->StemSnapV);
+            strike_md5_array(&md5, pdata->WeightVector);
+            /*
+             * Subrs end at the first index that is out of range; an
+             * entry that can't be read is only noted, so that it can't
+             * hide the ones after it.
+             */
+            for (global = 0; global < 2; global++) {
+                int i;
+
+                for (i = 0; i < max_ushort; i++) {
+                    gs_glyph_data_t gdata;
+
+                    gdata.memory = font->memory;
+                    code = pdata->procs.subr_data(pfont, i, global, &gdata);
+                    if (code == gs_error_rangecheck)
+                        break;
+                    strike_md5_value(&md5, code);
+                    if (code >= 0)
+                        strike_md5_glyph_data(&md5, &gdata);
+                }
+                if (i == max_ushort)
+                    return 1;
+            }
+            break;
+        }
+        case ft_TrueType: {
+            /* The tables used by the instructions or by all the glyphs. */
+            static const char *const tables[] = {
+                "head", "hhea", "vhea", "maxp", "cvt ", "fpgm", "prep"
+            };
+            gs_font_type42 *const pfont = (gs_font_type42 *)font;
+            byte OffsetTable[12];
+            byte entry[16];
+            uint numTables, i, j;
+
+            code = gs_type42_read_data(pfont, 0, 12, OffsetTable);
+            if (code < 0)
+                return code;
+            if (memcmp(OffsetTable, "\000\001\000\000", 4) &&
+                memcmp(OffsetTable, "true", 4))
+                return 1;	/* e.g. a collection */
+            numTables = U16(OffsetTable + 4);
+            for (j = 0; j < countof(tables); j++) {
+                for (i = 0; i < numTables; i++) {
+                    code = gs_type42_read_data(pfont, 12 + i * 16, 16, entry);
+                    if (code < 0)
+                        return code;
+                    if (!memcmp(entry, tables[j], 4))
+                        break;
+                }
+                strike_md5_value(&md5, i);
+                if (i < numTables) {
+                    code = strike_md5_sfnts(&md5, pfont, u32(entry + 8),
+                                            u32(entry + 12));
+                    if (code < 0)
+                        return code;
+                }
+            }
+            break;
+        }
+        default:
+            return 1;
+    }
+    gs_md5_finish(&md5, digest);
+    return 0;
+}
+
+/* Add the program of a glyph and of any pieces it is built from. */
+static int
+strike_md5_glyph(gs_md5_state_t *pmd5, gs_font *font, gs_glyph glyph,
+                 int depth)
+{
+    gs_glyph pieces[strike_max_pieces];
+    gs_glyph_data_t gdata;
+    gs_glyph_info_t info;
+    int code, i;
+
+    gdata.memory = font->memory;
+    if (font->FontType == ft_TrueType) {
+        gs_font_type42 *const pfont = (gs_font_type42 *)font;
+        uint glyph_index = pfont->data.get_glyph_index(pfont, glyph);
+
+        code = pfont->data.get_outline(pfont, glyph_index, &gdata);
+    } else {
+        gs_font_type1 *const pfont = (gs_font_type1 *)font;
+
+        code = pfont->data.procs.glyph_data(pfont, glyph, &gdata);
+    }
+    if (code < 0)
+        return code;
+    strike_md5_glyph_data(pmd5, &gdata);
+    code = font->procs.glyph_info(font, glyph, NULL, GLYPH_INFO_NUM_PIECES,
+                                  &info);
+    if (code < 0)
+        return code;
+    strike_md5_value(pmd5, info.num_pieces);
+    if (info.num_pieces == 0)
+        return 0;
+    if (info.num_pieces > strike_max_pieces || depth >= strike_max_depth)
+        return 1;
+    info.pieces = pieces;
+    code = font->procs.glyph_info(font, glyph, NULL,
+                                  GLYPH_INFO_NUM_PIECES | GLYPH_INFO_PIECES,
+                                  &info);
+    if (code < 0)
+        return code;
+    for (i = 0; i < info.num_pieces; i++) {
+        code = strike_md5_glyph(pmd5, font, pieces[i], depth + 1);
+        if (code != 0)
+            return code;
+    }
+    return 0;
+}
+
+/*
+ * Compute the digest of a glyph, which identifies it in a strike.
+ * Return 1 if the glyph can't be kept.
+ */
+static int
+strike_glyph_digest(gx_glyph_strike *ps, gs_font *font, gs_glyph glyph,
+                    int wmode, gs_md5_byte_t digest[16])
+{
+    gs_md5_state_t md5;
+    gs_glyph_info_t info;
+    int code;
+
+    /*
+     * The glyphs of a Type 1 font that has called an OtherSubr the
+     * interpreter doesn't know are drawn partly by the font's own
+     * OtherSubrs procedures, which aren't part of the digest.
+     */
+    if (font->FontType != ft_TrueType &&
+        ((gs_font_type1 *)font)->data.client_OtherSubrs)
+        return 1;
+    if (glyph == ps->last_glyph && wmode == ps->last_wmode) {
+        memcpy(digest, ps->last_digest, 16);
+        return 0;
+    }
+    gs_md5_init(&md5);
+    code = strike_md5_glyph(&md5, font, glyph, 0);
+    if (code != 0)
+        return code;
+    /*
+     * The metrics may be changed by the font dictionary (Metrics);
+     * asking for CDevProc makes a font that has one fail.
+     */
+    code = font->procs.glyph_info(font, glyph, NULL,
+                                  ((GLYPH_INFO_WIDTH0 | GLYPH_INFO_VVECTOR0)
+                                   << wmode) | GLYPH_INFO_CDEVPROC, &info);
+    if (code < 0)
+        return code;
+    strike_md5_value(&md5, wmode);
+    strike_md5_value(&md5, info.width[wmode]);
+    if (info.members & (GLYPH_INFO_VVECTOR0 << wmode))
+        strike_md5_value(&md5, info.v);
+    gs_md5_finish(&md5, digest);
+    ps->last_glyph = glyph;
+    ps->last_wmode = wmode;
+    memcpy(ps->last_digest, digest, 16);
+    return 0;
+}
+
+/* ------ Strikes ------ */
+
+static bool
+strike_font_matches(const gx_glyph_strike *ps, const gs_font *font)
+{
+    return (font->FontMatrix.xx == ps->FontMatrix.xx &&
+            font->FontMatrix.xy == ps->FontMatrix.xy &&
+            font->FontMatrix.yx == ps->FontMatrix.yx &&
+            font->FontMatrix.yy == ps->FontMatrix.yy);
+}
+
+static void *
+strike_alloc(void *data, int size)
+{
+    return gs_alloc_bytes((gs_memory_t *)data, size, "strike data");
+}
+
+static uint
+strike_hash(const gs_md5_byte_t digest[16], int wmode, int depth,
+            const gs_fixed_point *subpix_origin)
+{
+    uint h = digest[0] | (digest[1] << 8) | (digest[2] << 16) |
+        ((uint)digest[3] << 24);
+
+    return h ^ (wmode << 3) ^ depth ^ (subpix_origin->x << 5) ^
+        (subpix_origin->y << 11);
+}
+
+/* Find a record, or the free index slot where it would go. */
+static uint *
+strike_find(gx_glyph_strike *ps, const gs_md5_byte_t digest[16], int wmode,
+            int depth, const gs_fixed_point *subpix_origin)
+{
+    uint mask = ps->index_size - 1;
+    uint i = strike_hash(digest, wmode, depth, subpix_origin) & mask;
+
+    for (;; i = (i + 1) & mask) {
+        const strike_char *sc;
+
+        if (ps->index[i] == 0)
+            return &ps->index[i];
+        sc = (const strike_char *)(ps->data + ps->index[i] - 1);
+        if (sc->wmode == wmode && sc->depth == depth &&
+            sc->subpix_origin.x == subpix_origin->x &&
+            sc->subpix_origin.y == subpix_origin->y &&
+            !memcmp(sc->digest, digest, 16))
+            return &ps->index[i];
+    }
+}
+
+/* Make room in the index for another record, rebuilding it if needed. */
+static int
+strike_index_reserve(gx_glyph_strike *ps)
+{
+    uint size = max(ps->index_size, 64), pos;
+    uint *index;
+
+    while (size < (ps->count + 1) * 2)
+        size <<= 1;
+    if (size == ps->index_size)
+        return 0;
+    index = (uint *)gs_alloc_byte_array(ps->memory, size, sizeof(uint),
+                                        "strike index");
+    if (index == 0)
+        return_error(gs_error_VMerror);
+    memset(index, 0, size * sizeof(uint));
+    gs_free_object(ps->memory, ps->index, "strike index");
+    ps->index = index;
+    ps->index_size = size;
+    for (pos = 0; pos < ps->size;) {
+        const strike_char *sc = (const strike_char *)(ps->data + pos);
+
+        *strike_find(ps, sc->digest, sc->wmode, sc->depth,
+                     &sc->subpix_origin) = pos + 1;
+        pos += sc->size;
+    }
+    return 0;
+}
+
+/*
+ * Index the records read from the cache, discarding anything from the
+ * first incomplete or inconsistent record on.  ps->size only covers the
+ * records checked so far, since those are what the index is built from.
+ */
+static void
+strike_check(gx_glyph_strike *ps)
+{
+    uint end = min(ps->size, strike_max_size);
+
+    ps->size = 0;
+    while (end - ps->size >= sizeof_strike_char) {
+        const strike_char *sc = (const strike_char *)(ps->data + ps->size);
+        uint dsize;
+        uint *pi;
+
+        if (sc->size % strike_align != 0 || sc->size > end - ps->size ||
+            sc->size < sizeof_strike_char)
+            break;
+        dsize = sc->size - sizeof_strike_char;
+        if (sc->depth == 0 || sc->depth > 8 ||
+            (sc->depth & (sc->depth - 1)) != 0 || sc->wmode > 1 ||
+            sc->raster < bitmap_raster((uint)sc->width * sc->depth) ||
+            (sc->raster != 0 && dsize / sc->raster < sc->height))
+            break;
+        if (strike_index_reserve(ps) < 0)
+            break;
+        pi = strike_find(ps, sc->digest, sc->wmode, sc->depth,
+                         &sc->subpix_origin);
+        if (*pi != 0)
+            break;		/* duplicate */
+        *pi = ps->size + 1;
+        ps->count++;
+        ps->size += sc->size;
+    }
+}
+
+/* Create a strike for a pair, reading any glyphs saved by earlier runs. */
+void
+gx_glyph_strike_open(gs_font_dir * dir, cached_fm_pair * pair,
+                     const gs_font * font, bool design_grid)
+{
+    gs_memory_t *mem = dir->ccache.bits_memory;
+    gx_glyph_strike *ps;
+    strike_key *pkey;
+    void *data;
+    int len;
+
+    pair->strike = 0;
+    if (!dir->glyph_disk_cache)
+        return;
+    ps = (gx_glyph_strike *)gs_alloc_bytes(mem, sizeof(*ps), "strike");
+    if (ps == 0)
+        return;
+    ps->memory = mem;
+    ps->key_size = sizeof(strike_key);
+    ps->key = gs_alloc_bytes(mem, ps->key_size, "strike key");
+    if (ps->key == 0) {
+        gs_free_object(mem, ps, "strike");
+        return;
+    }
+    pkey = (strike_key *)ps->key;
+    memset(pkey, 0, sizeof(*pkey));	/* clear the padding */
+    if (strike_font_digest((gs_font *)font, pkey->font_digest) != 0) {
+        gs_free_object(mem, ps->key, "strike key");
+        gs_free_object(mem, ps, "strike");
+        return;
+    }
+    memcpy(pkey->magic, "GSgd", 4);
+    pkey->revision = gs_revision;
+    pkey->FontType = pair->FontType;
+    pkey->fapi = (((const gs_font_base *)font)->FAPI != 0);
+    pkey->design_grid = design_grid;
+    pkey->align_to_pixels = dir->align_to_pixels;
+    pkey->grid_fit_tt = dir->grid_fit_tt;
+    pkey->mxx = pair->mxx, pkey->mxy = pair->mxy;
+    pkey->myx = pair->myx, pkey->myy = pair->myy;
+    pkey->fxx = font->FontMatrix.xx, pkey->fxy = font->FontMatrix.xy;
+    pkey->fyx = font->FontMatrix.yx, pkey->fyy = font->FontMatrix.yy;
+    ps->FontMatrix = font->FontMatrix;
+    ps->data = 0;
+    ps->size = ps->capacity = 0;
+    ps->index = 0;
+    ps->index_size = ps->count = 0;
+    ps->last_glyph = gs_no_glyph;
+    ps->last_wmode = 0;
+    len = gp_cache_query(GP_CACHE_TYPE_GLYPHS, ps->key, ps->key_size,
+                         &data, strike_alloc, mem);
+    if (len > 0 && data != 0) {
+        ps->data = data;
+        ps->size = ps->capacity = len;
+        strike_check(ps);
+    }
+    ps->saved = ps->size;
+    if_debug3('k', "[k]strike for pair 0x%lx: %u bytes from %s\n",
+              (ulong) pair, ps->size, (len > 0 ? "cache" : "nowhere"));
+    pair->strike = ps;
+}
+
+/* Write back a strike if it has new glyphs. */
+static void
+strike_save(gx_glyph_strike *ps)
+{
+    if (ps->size == ps->saved)
+        return;
+    if (gp_cache_insert(GP_CACHE_TYPE_GLYPHS, ps->key, ps->key_size,
+                        ps->data, ps->size) == 0)
+        ps->saved = ps->size;
+}
+
+/* Save and free a pair's strike. */
+void
+gx_glyph_strike_close(gs_font_dir * dir, cached_fm_pair * pair)
+{
+    gx_glyph_strike *ps = pair->strike;
+
+    if (ps == 0)
+        return;
+    pair->strike = 0;
+    strike_save(ps);
+    gs_free_object(ps->memory, ps->index, "strike index");
+    gs_free_object(ps->memory, ps->data, "strike data");
+    gs_free_object(ps->memory, ps->key, "strike key");
+    gs_free_object(ps->memory, ps, "strike");
+}
+
+/* Save all the strikes, e.g. at the end of a run. */
+void
+gs_font_dir_save_glyphs(gs_font_dir * dir)
+{
+    cached_fm_pair *pair = dir->fmcache.mdata;
+    int count = dir->fmcache.mmax;
+
+    for (; count--; pair++)
+        if (pair->strike != 0)
+            strike_save(pair->strike);
+}
+
+/* Add a newly rendered character to its pair's strike. */
+void
+gx_glyph_strike_add(gs_font_dir * dir, const gs_font * font,
+                    cached_fm_pair * pair, const cached_char * cc)
+{
+    gx_glyph_strike *ps = pair->strike;
+    uint bsize = cc_raster(cc) * cc->height;
+    gs_md5_byte_t digest[16];
+    uint rsize;
+    strike_char *sc;
+    uint *pi;
+
+    if (!cc_has_bits(cc) || !strike_font_matches(ps, font) ||
+        strike_glyph_digest(ps, (gs_font *)font, cc->code, cc->wmode,
+                            digest) != 0)
+        return;
+    rsize = sizeof_strike_char + ROUND_UP(bsize, strike_align);
+    if (rsize > strike_max_size - ps->size ||
+        strike_index_reserve(ps) < 0)
+        return;
+    pi = strike_find(ps, digest, cc->wmode, cc_depth(cc), &cc->subpix_origin);
+    if (*pi != 0)
+        return;			/* already there */
+    if (ps->capacity - ps->size < rsize) {
+        uint capacity = min(max(ps->capacity * 2, ps->size + rsize),
+                            strike_max_size);
+        byte *data = gs_alloc_bytes(ps->memory, capacity, "strike data");
+
+        if (data == 0)
+            return;
+        if (ps->size)
+            memcpy(data, ps->data, ps->size);
+        gs_free_object(ps->memory, ps->data, "strike data");
+        ps->data = data;
+        ps->capacity = capacity;
+    }
+    sc = (strike_char *)(ps->data + ps->size);
+    memset(sc, 0, rsize);
+    sc->size = rsize;
+    memcpy(sc->digest, digest, 16);
+    sc->subpix_origin = cc->subpix_origin;
+    sc->offset = cc->offset;
+    sc->wxy = cc->wxy;
+    sc->width = cc->width;
+    sc->height = cc->height;
+    sc->raster = cc_raster(cc);
+    sc->wmode = cc->wmode;
+    sc->depth = cc_depth(cc);
+    memcpy(strike_char_bits(sc), cc_const_bits(cc), bsize);
+    *pi = ps->size + 1;
+    ps->count++;
+    ps->size += rsize;
+}
+
+/*
+ * Look for a character in a pair's strike.  If it is there, add it to
+ * the character cache and return it; otherwise return 0.
+ */
+cached_char *
+gx_glyph_strike_lookup(gs_font_dir * dir, const gs_font * pfont,
+                       cached_fm_pair * pair, gs_glyph glyph, int wmode,
+                       int depth, const gs_fixed_point * subpix_origin)
+{
+    gx_glyph_strike *ps = pair->strike;
+    static const gs_log2_scale_point no_scale = {0, 0};
+    gs_md5_byte_t digest[16];
+    const strike_char *sc;
+    cached_char *cc;
+    uint pos;
+
+    if (ps->count == 0 || !strike_font_matches(ps, pfont) ||
+        strike_glyph_digest(ps, (gs_font *)pfont, glyph, wmode, digest) != 0)
+        return 0;
+    pos = *strike_find(ps, digest, wmode, depth, subpix_origin);
+    if (pos == 0)
+        return 0;
+    sc = (const strike_char *)(ps->data + pos - 1);
+    if (gx_alloc_cached_char(dir, sc->raster * sc->height, &cc) < 0 ||
+        cc == 0)
+        return 0;
+    cc_set_depth(cc, sc->depth);
+    cc->width = sc->width;
+    cc->height = sc->height;
+    cc_set_raster(cc, sc->raster);
+    cc->code = glyph;
+    cc->wmode = wmode;
+    cc->subpix_origin = sc->subpix_origin;
+    cc->offset = sc->offset;
+    cc->wxy = sc->wxy;
+    memcpy(cc_bits(cc), strike_char_bits(sc), sc->raster * sc->height);
+    cc->id = gs_next_ids(dir->memory, 1);
+    if (gx_add_cached_char(dir, NULL, cc, pair, &no_scale) < 0) {
+        gx_free_cached_char(dir, cc);
+        return 0;
+    }
+    if_debug2('k', "[k]glyph 0x%lx from strike, pair 0x%lx\n",
+              (ulong) glyph, (ulong) pair);
+    return cc;
+}
@@ -135,6 +135,7 @@ gx_char_cache_init(register gs_font_dir * dir)
         fm_pair_init(pair);
         pair->ttf = 0;
         pair->ttr = 0;
+        pair->strike = 0;
     }
 }
 
@@ -349,6 +350,7 @@ gx_add_fm_pair(register gs_font_dir * dir, gs_font * font, const gs_uid * puid,
     pair->ttf = 0;
     pair->ttr = 0;
     pair->design_grid = false;
+    pair->strike = 0;
     if (does_font_need_tt_interpreter(font)) {
             code = gx_attach_tt_interpreter(dir, (gs_font_type42 *)font, pair,
                                 char_tm, log2_scale, design_grid);
@@ -356,6 +358,7 @@ gx_add_fm_pair(register gs_font_dir * dir, gs_font * font, const gs_uid * puid,
                 return code;
         }
     pair->memory = 0;
+    gx_glyph_strike_open(dir, pair, font, design_grid);
     if_debug8('k', "[k]adding pair 0x%lx: font=0x%lx [%g %g %g %g] UID %ld, 0x%lx\n",
               (ulong) pair, (ulong) font,
               pair->mxx, pair->mxy, pair->myx, pair->myy,
@@ -434,6 +437,7 @@ gs_purge_fm_pair(gs_font_dir * dir, cached_fm_pair * pair, int xfont_only)
                      pair->num_chars);
         }
 #endif
+        gx_glyph_strike_close(dir, pair);
         {   /* Free xvalues here because gx_add_fm_pair copied
                them into the stable memory dir->memory. */
             gs_free_object(dir->memory->stable_memory, pair->UID.xvalues, "gs_purge_fm_pair");
@@ -527,7 +531,9 @@ gx_alloc_char_bits(gs_font_dir * dir, gx_device_memory * dev,
         rc_decrement_only(target, "gx_alloc_char_bits"); /* can't go to 0 */
         pdev->rc = rc;
         pdev->retained = retained;
-        pdev->width = iwidth;
+        /* Without oversampling, a character with depth > 1 gets */
+        /* its alpha values written straight into the bits. */
+        pdev->width = (log2_xscale == 0 ? nwidth_bits : iwidth);
         pdev->height = iheight;
         gdev_mem_bitmap_size(pdev, &isize);	/* Assume less than max_ulong */
         pdev->HWResolution[0] = HWResolution0;
@@ -569,7 +575,8 @@ gx_alloc_char_bits(gs_font_dir * dir, gx_device_memory * dev,
     cc_set_depth(cc, depth);
     cc->xglyph = gx_no_xglyph;
     /* Set the width and height to those of the device. */
-    /* Note that if we are oversampling without an alpha buffer. */
+    /* Note that if we are oversampling without an alpha buffer, */
+    /* or writing alpha values into a monobit device, */
     /* these are not the final unscaled dimensions. */
     cc->width = pdev2->width;
     cc->height = pdev2->height;
@@ -599,6 +606,107 @@ gx_alloc_char_bits(gs_font_dir * dir, gx_device_memory * dev,
     return 0;
 }
 
+/*
+ * Allocate a cached character for bits that have already been rendered,
+ * e.g. ones read from the persistent cache.  The caller fills in the
+ * rest of the entry and adds it with gx_add_cached_char (dev = NULL).
+ * Return the cached_char if OK, 0 if too big.
+ */
+int
+gx_alloc_cached_char(gs_font_dir * dir, uint bsize, cached_char **pcc)
+{
+    cached_char *cc;
+    int code;
+
+    *pcc = 0;
+    if (bsize > dir->ccache.upper)
+        return 0;
+    code = alloc_char(dir, sizeof_cached_char +
+                      ROUND_UP(bsize, align_cached_char_mod), &cc);
+    if (code < 0 || cc == 0)
+        return code;
+    cc->xglyph = gx_no_xglyph;
+    cc->shift = 0;
+    cc_set_pair_only(cc, 0);
+    cc->id = gx_no_bitmap_id;
+    cc->linked = false;
+    *pcc = cc;
+    return 0;
+}
+
+/*
+ * Keep a character that is still in use from falling out of the cache.
+ * Allocation works through the current chunk from ccache.cnext, freeing
+ * whatever it finds there, so by itself the cache evicts the oldest
+ * characters whether or not they are being used.  When a lookup hits a
+ * character in the part of the cache that will be reused next, we copy
+ * it to the allocation point (or, if it is right at the front, simply
+ * move the allocation point past it), which gives an approximation to
+ * LRU at no cost for the other hits.  The bitmap id is kept, so devices
+ * and band lists that have seen the bits can still recognize them.
+ * Return the character, which may have moved.
+ */
+cached_char *
+gx_touch_cached_char(gs_font_dir * dir, cached_char * cc)
+{
+    char_cache_chunk *cck = dir->ccache.chunks;
+    uint cnext = dir->ccache.cnext;
+    uint size = cc->head.size;
+    uint end = cnext + size + sizeof(cached_char_head);
+    uint ahead, offset, chi;
+    cached_char *ncc;
+    int code;
+
+    /* Once the cache is full, the next chunk is reused after this one. */
+    if (cc->chunk == cck && cc->loc >= cnext)
+        ahead = cc->loc - cnext;
+    else if (cc->chunk == cck->next && cck->next != cck &&
+             dir->ccache.bspace >= dir->ccache.bmax)
+        ahead = cck->size - cnext + cc->loc;
+    else
+        return cc;
+    if (ahead >= dir->ccache.bmax >> 3)
+        return cc;		/* not about to be evicted */
+    if (cc->chunk == cck && cc->loc < end) {
+        dir->ccache.cnext = cc->loc + size;
+        return cc;
+    }
+    if (end > cck->size)
+        return cc;		/* no room in this chunk */
+    /*
+     * Don't evict a character that is still being rendered (for
+     * instance, by the BuildChar procedure that is doing this show).
+     */
+    for (offset = cnext; offset < end;) {
+        const cached_char_head *cch =
+            (const cached_char_head *)(cck->data + offset);
+
+        if (!cc_head_is_free(cch) && !((const cached_char *)cch)->linked)
+            return cc;
+        offset += cch->size;
+    }
+    code = alloc_char_in_chunk(dir, size, &ncc);
+    if (code < 0 || ncc == 0)
+        return cc;
+    /* Copy everything except the block header and the location. */
+    memcpy((byte *)ncc + sizeof(cached_char_head),
+           (const byte *)cc + sizeof(cached_char_head),
+           size - sizeof(cached_char_head));
+    cc_set_depth(ncc, cc_depth(cc));
+    ncc->chunk = cck;
+    ncc->loc = (byte *)ncc - cck->data;
+    cck = cc->chunk;
+    /* Evicting other characters may have moved cc in the hash table. */
+    chi = chars_head_index(cc->code, cc_pair(cc));
+    while (dir->ccache.table[chi &= dir->ccache.table_mask] != cc)
+        chi++;
+    dir->ccache.table[chi] = ncc;
+    gx_bits_cache_free((gx_bits_cache *) & dir->ccache, &cc->head, cck);
+    if_debug3('k', "[k]moving char 0x%lx to 0x%lx (%u)\n",
+              (ulong) cc, (ulong) ncc, size);
+    return ncc;
+}
+
 /* Open the cache device. */
 void
 gx_open_cache_device(gx_device_memory * dev, cached_char * cc)
@@ -986,6 +1094,7 @@ alloc_char_in_chunk(gs_font_dir * dir, ulong icdsize, cached_char **pcc)
                         return_error(gs_error_unregistered); /* Must not happen. */
                 }
                 hash_remove_cached_char(dir, chi);
+                dir->ccache.evictions++;
             }
 
             gx_free_cached_char(dir, cc);
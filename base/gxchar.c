@@ -467,6 +467,15 @@ compute_glyph_raster_params(gs_show_enum *penum, bool in_setcachedevice, int *al
      */
     *depth = (log2_scale->x + log2_scale->y == 0 ?
         1 : min(log2_scale->x + log2_scale->y, *alpha_bits));
+    /*  A FAPI server renders anti-aliased characters as coverage values
+     * at the device resolution (see zfapi.c), so they are cached
+     * with the full alpha depth and no oversampling.
+     */
+    if (*depth > 1 && penum->current_font->FontType != ft_composite &&
+        ((gs_font_base *)penum->current_font)->FAPI != NULL) {
+        log2_scale->x = log2_scale->y = 0;
+        *depth = *alpha_bits;
+    }
     if (gs_currentaligntopixels(penum->current_font->dir) == 0) {
         int scx = -1L << (_fixed_shift - log2_scale->x);
         int rdx =  1L << (_fixed_shift - 1 - log2_scale->x);
@@ -832,6 +841,8 @@ show_update(gs_show_enum * penum)
                                cc, pair, &penum->log2_scale);
                 if (code < 0)
                     return code;
+                if (pair->strike != 0)
+                    gx_glyph_strike_add(pgs->font->dir, pgs->font, pair, cc);
             }
             if (!SHOW_USES_OUTLINE(penum) ||
                 penum->charpath_flag != cpm_show
@@ -1062,6 +1073,9 @@ show_proceed(gs_show_enum * penum)
                         }
                         cc = gx_lookup_cached_char(pfont, pair, glyph, wmode,
                                                    depth, &subpix_origin);
+                        if (cc == 0 && pair->strike != 0)
+                            cc = gx_glyph_strike_lookup(pfont->dir, pfont, pair,
+                                        glyph, wmode, depth, &subpix_origin);
                     }
                     if (cc == 0) {
                         goto no_cache;
@@ -24,6 +24,7 @@
 #include "gxdevmem.h"		/* must precede gxcldev.h */
 #include "gdevprn.h"            /* for BLS_force_memory */
 #include "gxcldev.h"
+#include "gxclpath.h"		/* for cmd_opv_ext_glyph_run */
 #include "gxfmap.h"
 
 /*
@@ -773,3 +774,85 @@ clist_change_bits(gx_device_clist_writer * cldev, gx_clist_state * pcls,
         return code;
     goto top;
 }
+
+/*
+ * Make sure that a band knows a bitmap for clist_fill_mask, writing the
+ * bits if necessary, and return its tile index.  Unlike clist_change_bits,
+ * this doesn't write a command to select a bitmap which the band already
+ * knows: cmd_put_glyph addresses it by index.
+ */
+int
+clist_find_band_bits(gx_device_clist_writer * cldev, gx_clist_state * pcls,
+                     const gx_strip_bitmap * tiles, int depth, uint * pindex)
+{
+    tile_loc loc;
+    int code;
+
+    if (clist_find_bits(cldev, tiles->id, &loc)) {
+        uint band_index = pcls - cldev->states;
+        byte *bptr = ts_mask(loc.tile) + (band_index >> 3);
+
+        if (*bptr & (1 << (band_index & 7))) {
+            *pindex = loc.index;
+            return 0;
+        }
+    }
+    code = clist_change_bits(cldev, pcls, tiles, depth);
+    if (code < 0)
+        return code;
+    *pindex = pcls->tile_index;
+    return 0;
+}
+
+/*
+ * Write a cached glyph at (x, y) into a band.  Consecutive glyphs for the
+ * same band form a run, a single command holding the tile index and the
+ * position of each glyph, which is extended in place as long as nothing
+ * else has been written after it, up to 255 glyphs.  The first position
+ * in a run is absolute, the others are relative to the previous glyph.
+ */
+int
+cmd_put_glyph(gx_device_clist_writer * cldev, gx_clist_state * pcls,
+              uint index, gx_bitmap_id id, int x, int y, int depth)
+{
+    byte *run = cldev->glyph_run;
+    byte *dp;
+    int code;
+
+    if (cldev->glyph_run_end == cldev->cnext && cldev->ccl == &pcls->list &&
+        (byte *)(pcls->list.tail + 1) + pcls->list.tail->size == cldev->cnext &&
+        run[-1] == depth && *run != 0xff
+        ) {
+        uint dx = cmd_glyph_delta(x - cldev->glyph_run_pos.x);
+        uint dy = cmd_glyph_delta(y - cldev->glyph_run_pos.y);
+        uint size = cmd_size_w(index) + cmd_size2w(dx, dy);
+
+        if (size + cmd_headroom <= cldev->cend - cldev->cnext) {
+            /* Append to the run. */
+            dp = cmd_put_op(cldev, pcls, size);
+            if (dp == 0)
+                return cldev->error_code;
+            ++*run;
+            dp = cmd_put_w(index, dp);
+            cmd_put2w(dx, dy, dp);
+            goto done;
+        }
+    }
+    code = set_cmd_put_op(dp, cldev, pcls, cmd_opv_extend,
+                          4 + cmd_size_w(index) + cmd_size2w(x, y));
+    if (code < 0)
+        return code;
+    dp[1] = cmd_opv_ext_glyph_run;
+    dp[2] = depth;
+    dp[3] = 1;
+    cldev->glyph_run = dp + 3;
+    dp = cmd_put_w(index, dp + 4);
+    cmd_put2w(x, y, dp);
+done:
+    cldev->glyph_run_end = cldev->cnext;
+    cldev->glyph_run_pos.x = x;
+    cldev->glyph_run_pos.y = y;
+    pcls->tile_index = index;
+    pcls->tile_id = id;
+    return 0;
+}
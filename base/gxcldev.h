@@ -398,6 +398,8 @@ void cmd_print_stats(void);
 
 /* Add a command to the appropriate band list, */
 /* and allocate space for its data. */
+/* The buffer is written out unless size + cmd_headroom bytes are free. */
+#define cmd_headroom (sizeof(cmd_prefix) + ARCH_ALIGN_PTR_MOD)
 byte *cmd_put_list_op(gx_device_clist_writer * cldev, cmd_list * pcl, uint size);
 
 /* Request a space in the buffer.
@@ -473,6 +475,13 @@ byte *cmd_put_w(uint, byte *);
    (dp = cmd_put_w((uint)(wy), cmd_put_w((uint)(wx), dp))))
 #define cmd_putxy(xy,dp) cmd_put2w((xy).x, (xy).y, dp)
 
+/* Glyph run positions are signed deltas, stored with the sign in the */
+/* low bit so that small negative values stay short. */
+#define cmd_glyph_delta(d)\
+  ((d) < 0 ? ((uint)-(d) << 1) - 1 : (uint)(d) << 1)
+#define cmd_glyph_delta_value(u)\
+  ((u) & 1 ? -(int)(((u) + 1) >> 1) : (int)((u) >> 1))
+
 int cmd_size_frac31(register frac31 w);
 byte * cmd_put_frac31(register frac31 w, register byte * dp);
 
@@ -720,6 +729,16 @@ int clist_change_tile(gx_device_clist_writer * cldev, gx_clist_state * pcls,
 int clist_change_bits(gx_device_clist_writer * cldev, gx_clist_state * pcls,
                       const gx_strip_bitmap * tiles, int depth);
 
+/*
+ * Make sure that a band knows the bits of a glyph, and write the glyph
+ * into the band's glyph run (see gxclbits.c).
+ */
+int clist_find_band_bits(gx_device_clist_writer * cldev, gx_clist_state * pcls,
+                         const gx_strip_bitmap * tiles, int depth,
+                         uint * pindex);
+int cmd_put_glyph(gx_device_clist_writer * cldev, gx_clist_state * pcls,
+                  uint index, gx_bitmap_id id, int x, int y, int depth);
+
 /* ------ Exported by gxclimag.c ------ */
 
 /*
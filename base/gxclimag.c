@@ -154,6 +154,39 @@ clist_fill_mask(gx_device * dev,
         re.pcls->color_usage.slow_rop |= slow_rop;
         re.pcls->band_complexity.nontrivial_rops |= slow_rop;
         re.pcls->band_complexity.uses_color |= (pdcolor->colors.pure != 0 && pdcolor->colors.pure != 0xffffff);
+        if (orig_data_x == 0 && data_x == 0 && rwidth == orig_width &&
+            rheight == orig_height) {
+            /*
+             * Add the character to the band's glyph run.  The reader takes
+             * the size from the tile, so only uncropped characters qualify.
+             */
+            gx_strip_bitmap tile;
+            uint index;
+
+            tile.data = (byte *) orig_data;     /* actually const */
+            tile.raster = raster;
+            tile.size.x = tile.rep_width = orig_width;
+            tile.size.y = tile.rep_height = orig_height;
+            tile.rep_shift = tile.shift = 0;
+            tile.id = id;
+            tile.num_planes = 1;
+            do {
+                code = clist_find_band_bits(cdev, re.pcls, &tile, depth, &index);
+            } while (RECT_RECOVER(code));
+            if (code < 0 && !(code != gs_error_VMerror || !cdev->error_is_retryable) && SET_BAND_CODE(code))
+                goto error_in_rect;
+            if (code < 0)
+                goto copy;
+            do {
+                code = cmd_put_glyph(cdev, re.pcls, index, id, orig_x, y0, depth);
+            } while (RECT_RECOVER(code));
+            if (code < 0 && SET_BAND_CODE(code))
+                goto error_in_rect;
+            re.pcls->rect.x = orig_x, re.pcls->rect.y = y0;
+            re.pcls->rect.width = orig_width;
+            re.pcls->rect.height = re.yend - y0;
+            goto end;
+        }
         /* Put it in the cache if possible. */
         if (!cls_has_tile_id(cdev, re.pcls, id, offset_temp)) {
             gx_strip_bitmap tile;
@@ -126,10 +126,26 @@ static const gx_device_clip gs_clip_device =
  }
 };
 
+/*
+ * Index the clip list of a clipping path the first time we clip with it,
+ * if it is long enough.  Failing to index is not an error: the clipper
+ * walks the list instead.
+ */
+static void
+clip_index_path_list(const gx_clip_path *pcpath)
+{
+    gx_clip_rect_list *rlist = pcpath->rect_list;
+
+    if (rlist->list.count >= CLIP_INDEX_MIN_RECTS && rlist->list.index == 0 &&
+        rlist->rc.memory != 0)
+        (void)gx_clip_list_index(&rlist->list, rlist->rc.memory);
+}
+
 /* Make a clipping device. */
 void
 gx_make_clip_device_on_stack(gx_device_clip * dev, const gx_clip_path *pcpath, gx_device *target)
 {
+    clip_index_path_list(pcpath);
     gx_device_init((gx_device *)dev, (const gx_device *)&gs_clip_device, NULL, true);
     dev->list = *gx_cpath_list(pcpath);
     dev->translation.x = 0;
@@ -167,6 +183,7 @@ gx_make_clip_device_on_stack_if_needed(gx_device_clip * dev, const gx_clip_path
         if (rect->p.x >= rect->q.x || rect->p.y >= rect->q.y)
             return NULL;
     }
+    clip_index_path_list(pcpath);
     gx_device_init((gx_device *)dev, (const gx_device *)&gs_clip_device, NULL, true);
     dev->list = *gx_cpath_list(pcpath);
     dev->translation.x = 0;
@@ -184,6 +201,7 @@ void
 gx_make_clip_device_in_heap(gx_device_clip * dev, const gx_clip_path *pcpath, gx_device *target,
                               gs_memory_t *mem)
 {
+    clip_index_path_list(pcpath);
     gx_device_init((gx_device *)dev, (const gx_device *)&gs_clip_device, mem, true);
     dev->list = *gx_cpath_list(pcpath);
     dev->translation.x = 0;
@@ -211,6 +229,83 @@ static const uint clip_interval = 10000;
 # define INCR_THEN(v, e) (e)
 #endif
 
+/*
+ * Enumerate the rectangles of an indexed clip list that fall within
+ * x,y,xe,ye: find the first row and, in each row, the first rectangle
+ * by binary search.  Like the list walk below, we merge full-width
+ * rectangles of adjacent rows into a single vertical swath.
+ */
+static inline int
+clip_index_first_span(const gx_clip_index_span *span, int lo, int hi, int x)
+{
+    /* Return the first span in [lo,hi) with xmax > x. */
+    while (lo < hi) {
+        int mid = (lo + hi) >> 1;
+
+        if (span[mid].xmax > x)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+static int
+clip_enumerate_index(const gx_clip_index *pci,
+                     int x, int y, int xe, int ye,
+                     int (*process)(clip_callback_data_t * pccd,
+                                    int xc, int yc, int xec, int yec),
+                     clip_callback_data_t * pccd)
+{
+    const gx_clip_index_row *row = clip_index_rows(pci);
+    const gx_clip_index_span *span = clip_index_spans(pci);
+    int nrows = pci->row_count;
+    int lo = 0, hi = nrows;
+    int code;
+
+    /* Find the first row with ymax > y. */
+    while (lo < hi) {
+        int mid = (lo + hi) >> 1;
+
+        if (row[mid].ymax > y)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    for (; lo < nrows && row[lo].ymin < ye; lo++) {
+        int yc = max(row[lo].ymin, y);
+        int yec = min(row[lo].ymax, ye);
+        int end = row[lo + 1].first;
+        int i = clip_index_first_span(span, row[lo].first, end, x);
+
+        for (; i < end && span[i].xmin < xe; i++) {
+            int xc = max(span[i].xmin, x);
+            int xec = min(span[i].xmax, xe);
+
+            INCR(x);
+#ifdef CHECK_VERTICAL_CLIPPING
+            if (xc == x && xec == xe) {	/* full width */
+                /* Look ahead for a vertical swath. */
+                while (lo + 1 < nrows && row[lo + 1].ymin == yec &&
+                       row[lo + 1].ymax <= ye) {
+                    int j = clip_index_first_span(span, row[lo + 1].first,
+                                                  row[lo + 2].first, x);
+
+                    if (j == row[lo + 2].first ||
+                        span[j].xmin > x || span[j].xmax < xe)
+                        break;
+                    yec = row[++lo].ymax;
+                }
+                i = end;	/* nothing else in the row is visible */
+            }
+#endif
+            code = process(pccd, xc, yc, xec, yec);
+            if (code < 0)
+                return code;
+        }
+    }
+    return 0;
+}
+
 /*
  * Enumerate the rectangles of the x,w,y,h argument that fall within
  * the clipping region.
@@ -238,6 +333,9 @@ clip_enumerate_rest(gx_device_clip * rdev,
 #endif
     pccd->x = x, pccd->y = y;
     pccd->w = xe - x, pccd->h = ye - y;
+    if (rdev->list.index != 0)
+        return clip_enumerate_index(rdev->list.index, x, y, xe, ye,
+                                    process, pccd);
     /*
      * Warp the cursor forward or backward to the first rectangle row
      * that could include a given y value.  Assumes rptr is set, and
@@ -349,6 +447,13 @@ clip_enumerate(gx_device_clip * rdev, int x, int y, int w, int h,
     return clip_enumerate_rest(rdev, x, y, xe, ye, process, pccd);
 }
 
+/* Test whether a device is a clipping device. */
+bool
+gx_device_is_clip(const gx_device * dev)
+{
+    return dev_proc(dev, open_device) == clip_open;
+}
+
 /* Open a clipping device */
 static int
 clip_open(gx_device * dev)
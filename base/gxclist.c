@@ -490,6 +490,7 @@ clist_reset(gx_device * dev)
        sizeof(*cdev->tile_table));
     cdev->cnext = cdev->cbuf;
     cdev->ccl = 0;
+    cdev->glyph_run_end = 0;
     cdev->band_range_list.head = cdev->band_range_list.tail = 0;
     cdev->band_range_min = 0;
     cdev->band_range_max = nbands - 1;
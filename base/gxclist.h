@@ -300,6 +300,9 @@ struct gx_device_clist_writer_s {
     byte *cnext;		/* next slot in command buffer */
     byte *cend;			/* end of command buffer */
     cmd_list *ccl;		/* &clist_state.list of last command */
+    byte *glyph_run;		/* count of the last glyph run, the end */
+    byte *glyph_run_end;	/* of its data and the position of its */
+    gs_int_point glyph_run_pos;	/* last glyph, see cmd_put_glyph */
     cmd_list band_range_list;	/* list of band-range commands */
     int band_range_min, band_range_max;		/* range for list */
     uint tile_max_size;		/* max size of a single tile (bytes) */
@@ -165,7 +165,11 @@ typedef enum {
     cmd_opv_ext_put_tile_devn_color0 = 0x6,  /* Devn color0 for tile filling */
     cmd_opv_ext_put_tile_devn_color1 = 0x7,   /* Devn color1 for tile filling */
     cmd_opv_ext_set_color_is_devn = 0x8,      /* Used for overload of copy_color_alpha */
-    cmd_opv_ext_unset_color_is_devn = 0x9     /* Used for overload of copy_color_alpha */
+    cmd_opv_ext_unset_color_is_devn = 0x9,    /* Used for overload of copy_color_alpha */
+    cmd_opv_ext_glyph_run = 0xa              /* depth, count(1 byte), */
+                                             /* index#, x#, y#, */
+                                             /* (count - 1) * (index#, dx#, dy#) */
+                                             /* (dx, dy per cmd_glyph_delta) */
 } gx_cmd_ext_op;
 
 #define cmd_segment_op_num_operands_values\
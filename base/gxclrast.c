@@ -1716,6 +1716,64 @@ idata:                  data_size = 0;
                                 state.color_is_devn = false;
                                 if_debug0('L', " ext_unset_color_is_devn\n");
                                 break;
+                            case cmd_opv_ext_glyph_run:
+                                {
+                                    int run_depth = *cbp++;
+                                    uint count = *cbp++;
+                                    uint i, u;
+
+                                    if_debug2('L', " glyph_run depth=%d count=%u\n",
+                                              run_depth, count);
+                                    for (i = 0; i < count; i++) {
+                                        if (cbp >= cbuf.warn_limit) {
+                                            code = top_up_cbuf(&cbuf, &cbp);
+                                            if (code < 0)
+                                                goto out;
+                                        }
+                                        cmd_getw(state.tile_index, cbp);
+                                        if (i == 0) {
+                                            cmd_getw(state.rect.x, cbp);
+                                            cmd_getw(state.rect.y, cbp);
+                                        } else {
+                                            cmd_getw(u, cbp);
+                                            state.rect.x += cmd_glyph_delta_value(u);
+                                            cmd_getw(u, cbp);
+                                            state.rect.y += cmd_glyph_delta_value(u);
+                                        }
+                                        state_slot =
+                                            (tile_slot *) (cdev->chunk.data +
+                                                cdev->tile_table[state.tile_index].offset);
+                                        state.rect.width = state_slot->width;
+                                        state.rect.height = state_slot->height;
+                                        source = (byte *) (state_slot + 1);
+                                        if (run_depth == 1)
+                                            code = gx_image_fill_masked
+                                                (tdev, source, 0, state_slot->cb_raster,
+                                                 gx_no_bitmap_id,
+                                                 state.rect.x - x0, state.rect.y - y0,
+                                                 state.rect.width, state.rect.height,
+                                                 &dev_color, 1, imager_state.log_op,
+                                                 pcpath);
+                                        else if (state.color_is_devn)
+                                            code = (*dev_proc(tdev, copy_alpha_hl_color))
+                                                (tdev, source, 0, state_slot->cb_raster,
+                                                 gx_no_bitmap_id,
+                                                 state.rect.x - x0, state.rect.y - y0,
+                                                 state.rect.width, state.rect.height,
+                                                 &dev_color, run_depth);
+                                        else
+                                            code = (*dev_proc(tdev, copy_alpha))
+                                                (tdev, source, 0, state_slot->cb_raster,
+                                                 gx_no_bitmap_id,
+                                                 state.rect.x - x0, state.rect.y - y0,
+                                                 state.rect.width, state.rect.height,
+                                                 state.colors[1], run_depth);
+                                        if (code < 0)
+                                            goto out;
+                                    }
+                                }
+                                /* The last glyph is the current "tile". */
+                                goto sti;
                             case cmd_opv_ext_tile_rect_hl:
                                 /* Strip tile with devn colors */
                                 cbp = cmd_read_rect(op & 0xf0, &state.rect, cbp);
@@ -259,6 +259,7 @@ cmd_write_buffer(gx_device_clist_writer * cldev, byte cmd_end)
         pcls->list.head = pcls->list.tail = 0;
     cldev->cnext = cldev->cbuf;
     cldev->ccl = 0;
+    cldev->glyph_run_end = 0;
 #ifdef DEBUG
     if (gs_debug_c('l'))
         cmd_print_stats();
@@ -271,7 +272,6 @@ cmd_write_buffer(gx_device_clist_writer * cldev, byte cmd_end)
  * data.  Return the pointer to the data area.  If an error or (low-memory
  * warning) occurs, set cldev->error_code and return 0.
  */
-#define cmd_headroom (sizeof(cmd_prefix) + ARCH_ALIGN_PTR_MOD)
 byte *
 cmd_put_list_op(gx_device_clist_writer * cldev, cmd_list * pcl, uint size)
 {
@@ -104,7 +104,8 @@ static const gx_clip_list clip_list_empty = {
     0, /* insert */
     0, /* xmin */
     0, /* xmax */
-    0  /* count */
+    0, /* count */
+    0  /* index */
 };
 
 /* ------ Clipping path memory management ------ */
@@ -1029,9 +1030,64 @@ gx_clip_list_free(gx_clip_list * clp, gs_memory_t * mem)
         gs_free_object(mem, rp, "gx_clip_list_free");
         rp = prev;
     }
+    if (clp->index != 0)
+        gs_free_object(mem, clp->index, "gx_clip_list_free(index)");
     gx_clip_list_init(clp);
 }
 
+/* Index a clip list if it is long enough and not indexed yet. */
+int
+gx_clip_list_index(gx_clip_list * clp, gs_memory_t * mem)
+{
+    const gx_clip_rect *rp, *prev = 0;
+    int row_count = 0, span_count = 0;
+    gx_clip_index *pci;
+    gx_clip_index_row *row;
+    gx_clip_index_span *span;
+
+    if (clp->count < CLIP_INDEX_MIN_RECTS || clp->index != 0)
+        return 0;
+    /* Count the rows, checking the order the index relies on. */
+    for (rp = clp->head->next; rp != clp->tail; prev = rp, rp = rp->next) {
+        if (prev == 0 || rp->ymin != prev->ymin || rp->ymax != prev->ymax) {
+            if (prev != 0 && rp->ymin < prev->ymax)
+                return 0;
+            row_count++;
+        } else if (rp->xmin < prev->xmax)
+            return 0;
+        span_count++;
+    }
+    if (span_count != clp->count)
+        return 0;
+    pci = (gx_clip_index *)
+        gs_alloc_bytes(mem, sizeof(gx_clip_index) +
+                            (row_count + 1) * sizeof(gx_clip_index_row) +
+                            span_count * sizeof(gx_clip_index_span),
+                       "gx_clip_list_index");
+    if (pci == 0)
+        return_error(gs_error_VMerror);
+    pci->row_count = row_count;
+    pci->span_count = span_count;
+    row = clip_index_rows(pci) - 1;
+    span = clip_index_spans(pci);
+    for (rp = clp->head->next, prev = 0; rp != clp->tail;
+         prev = rp, rp = rp->next, span++) {
+        if (prev == 0 || rp->ymin != prev->ymin || rp->ymax != prev->ymax) {
+            row++;
+            row->ymin = rp->ymin;
+            row->ymax = rp->ymax;
+            row->first = span - clip_index_spans(pci);
+        }
+        span->xmin = rp->xmin;
+        span->xmax = rp->xmax;
+    }
+    row++;
+    row->ymin = row->ymax = max_int;
+    row->first = span_count;
+    clp->index = pci;
+    return 0;
+}
+
 /* Check whether a rectangle has a non-empty intersection with a clipping patch. */
 bool
 gx_cpath_rect_visible(gx_clip_path * pcpath, gs_int_rect *prect)
@@ -56,6 +56,33 @@ extern_st(st_clip_rect);
     clip_rect_enum_ptrs, clip_rect_reloc_ptrs, next, prev)
 #define st_clip_rect_max_ptrs 2
 
+/*
+ * A long clip list also gets an index, built the first time a clipping
+ * device is made for it, so that the clipper can find the rectangles
+ * for a given region by binary search instead of walking the list.
+ * The index is a single byte object, with no pointers, holding the
+ * rows of the list (runs of rectangles with the same Y values) followed
+ * by the X extents of all the rectangles, in list order.
+ */
+typedef struct gx_clip_index_row_s {
+    int ymin, ymax;
+    int first;			/* index of the row's first X extent */
+} gx_clip_index_row;
+typedef struct gx_clip_index_span_s {
+    int xmin, xmax;
+} gx_clip_index_span;
+typedef struct gx_clip_index_s {
+    int row_count;		/* followed by row_count + 1 rows, */
+    int span_count;		/* then span_count spans */
+} gx_clip_index;
+#define clip_index_rows(pci)\
+  ((gx_clip_index_row *)((pci) + 1))
+#define clip_index_spans(pci)\
+  ((gx_clip_index_span *)(clip_index_rows(pci) + (pci)->row_count + 1))
+
+/* Don't index lists shorter than this. */
+#define CLIP_INDEX_MIN_RECTS 32
+
 /*
  * A clip list may consist either of a single rectangle,
  * with null head and tail, or a list of rectangles.  In the latter case,
@@ -75,12 +102,13 @@ struct gx_clip_list_s {
     int xmin, xmax;		/* min and max X over all but head/tail */
     int count;			/* # of rectangles not counting */
                                 /* head or tail */
+    gx_clip_index *index;	/* 0 if not (yet) indexed */
 };
 
 #define public_st_clip_list()	/* in gxcpath.c */\
-  gs_public_st_ptrs2(st_clip_list, gx_clip_list, "clip_list",\
-    clip_list_enum_ptrs, clip_list_reloc_ptrs, head, tail)
-#define st_clip_list_max_ptrs 2	/* head, tail */
+  gs_public_st_ptrs3(st_clip_list, gx_clip_list, "clip_list",\
+    clip_list_enum_ptrs, clip_list_reloc_ptrs, head, tail, index)
+#define st_clip_list_max_ptrs 3	/* head, tail, index */
 #define clip_list_is_rectangle(clp) ((clp)->count <= 1)
 
 /*
@@ -115,6 +143,7 @@ void gx_make_clip_device_on_stack(gx_device_clip * dev, const gx_clip_path *pcpa
 gx_device *gx_make_clip_device_on_stack_if_needed(gx_device_clip * dev, const gx_clip_path *pcpath, gx_device *target, gs_fixed_rect *rect);
 void gx_make_clip_device_in_heap(gx_device_clip * dev, const gx_clip_path *pcpath, gx_device *target,
                               gs_memory_t *mem);
+bool gx_device_is_clip(const gx_device *dev);
 
 #define clip_rect_print(ch, str, ar)\
   if_debug7(ch, "[%c]%s 0x%lx: (%d,%d),(%d,%d)\n", ch, str, (ulong)ar,\
@@ -128,6 +157,9 @@ void gx_clip_list_init(gx_clip_list *);
 /* Free a clip list. */
 void gx_clip_list_free(gx_clip_list *, gs_memory_t *);
 
+/* Index a clip list if it is long enough and not indexed yet. */
+int gx_clip_list_index(gx_clip_list *, gs_memory_t *);
+
 /* Set the outer box for a clipping path from its bounding box. */
 void gx_cpath_set_outer_box(gx_clip_path *);
 
@@ -0,0 +1,76 @@
+/* Copyright (C) 2001-2012 Artifex Software, Inc.
+   All Rights Reserved.
+
+   This software is provided AS-IS with no warranty, either express or
+   implied.
+
+   This software is distributed under license and may not be copied,
+   modified or distributed except as expressly authorized under the terms
+   of the license contained in the file LICENSE in this distribution.
+
+   Refer to licensing information at http://www.artifex.com or contact
+   Artifex Software, Inc.,  7 Mt. Lassen Drive - Suite A-134, San Rafael,
+   CA  94903, U.S.A., +1(415)492-9861, for further information.
+*/
+
+
+/* Cache of clipping path intersections */
+
+#ifndef gxcpcache_INCLUDED
+#  define gxcpcache_INCLUDED
+
+#include "gsrefct.h"
+#include "gxfixed.h"
+
+/*
+ * PDF files typically re-establish the same clipping path for every
+ * object (q ... W n ... Q), which intersects the same path with the same
+ * clipping region over and over.  gx_cpath_intersect_path_slow remembers
+ * the last few intersections, keyed by the id of the incoming clipping
+ * path, the fill parameters, and the segments of the (device space) path,
+ * and shares the resulting rectangle list instead of accumulating it
+ * again.  The cache is reference counted: all the imager states copied
+ * from the one that allocated it share it.
+ */
+
+#ifndef gx_clip_cache_DEFINED
+#  define gx_clip_cache_DEFINED
+typedef struct gx_clip_cache_s gx_clip_cache;
+#endif
+
+#define CLIP_CACHE_SIZE 8
+#define CLIP_CACHE_MAX_PATH 65536	/* max # of values in a cached path */
+
+typedef struct gx_clip_cache_entry_s {
+    gs_id in_id;		/* incoming clipping path, gs_no_id if free */
+    int rule;
+    gs_fixed_point adjust;
+    float flatness;
+    uint hash;			/* hash of the path values */
+    int size;			/* # of path values */
+    fixed *path;		/* path values, see gxacpath.c */
+    struct gx_clip_rect_list_s *rect_list;	/* (RC) the intersection */
+    gs_fixed_rect bbox;
+    gs_fixed_rect inner_box;
+    gs_fixed_rect outer_box;
+    gs_id id;			/* id of the intersection */
+    ulong last_used;
+} gx_clip_cache_entry;
+
+struct gx_clip_cache_s {
+    rc_header rc;
+    gs_memory_t *memory;	/* stable memory for the cache and paths */
+    ulong use_count;
+    gx_clip_cache_entry entries[CLIP_CACHE_SIZE];
+};
+
+/* Allocate a cache.  Return 0 if we can't. */
+gx_clip_cache *gx_clip_cache_new(gs_memory_t * mem);
+
+/*
+ * Empty a cache.  This must be done before a restore, since the cached
+ * rectangle lists may have been allocated since the save.
+ */
+void gx_clip_cache_free_all(gx_clip_cache * pcc);
+
+#endif /* gxcpcache_INCLUDED */
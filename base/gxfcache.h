@@ -42,6 +42,11 @@ typedef struct cached_fm_pair_s cached_fm_pair;
 typedef struct gs_matrix_s gs_matrix;
 #endif
 
+#ifndef gx_glyph_strike_DEFINED
+#  define gx_glyph_strike_DEFINED
+typedef struct gx_glyph_strike_s gx_glyph_strike;
+#endif
+
 #ifndef ttfFont_DEFINED
 #  define ttfFont_DEFINED
 typedef struct ttfFont_s ttfFont;
@@ -66,6 +71,10 @@ typedef struct gx_device_spot_analyzer_s gx_device_spot_analyzer;
 #  define gs_state_DEFINED
 typedef struct gs_state_s gs_state;
 #endif
+#ifndef t1_hint_tables_DEFINED
+#  define t1_hint_tables_DEFINED
+typedef struct t1_hint_tables_s t1_hint_tables;
+#endif
 
 /*
  * Define the entry for a cached (font,matrix) pair.  If the UID
@@ -94,6 +103,8 @@ struct cached_fm_pair_s {
     gx_ttfReader *ttr;		/* True Type interpreter data. */
     bool design_grid;           /* A charpath font face.  */
     uint prev, next;            /* list of pairs. */
+    gx_glyph_strike *strike;	/* persistent glyphs (not GC'ed), */
+    /* see gxccdisk.c */
 };
 
 #define private_st_cached_fm_pair() /* in gxccman.c */\
@@ -270,6 +281,9 @@ typedef struct char_cache_s {
     uint upper;			/* max size of a single cached char */
     gs_glyph_mark_proc_t mark_glyph;
     void *mark_glyph_data;	/* closure data */
+    /* Statistics, reported as system parameters. */
+    ulong hits, misses;		/* gx_lookup_cached_char results */
+    ulong evictions;		/* chars freed to make room */
 } char_cache;
 
 /* ------ Font/character cache ------ */
@@ -315,7 +329,14 @@ struct gs_font_dir_s {
     gx_ttfMemory *ttm;
     /* User parameter GridFitTT. */
     uint grid_fit_tt;
+    /* User parameter GlyphDiskCache. */
+    bool glyph_disk_cache;
+    /* System parameter FAPIThreads. */
+    uint fapi_threads;
     gx_device_spot_analyzer *san;
+    /* Type 1 hint tables, see gxhintn.h. */
+    t1_hint_tables *hint_tables;
+    uint hint_tables_stamp;
     int (*global_glyph_code)(const gs_memory_t *mem, gs_const_string *gstr, gs_glyph *pglyph);
     ulong text_enum_id; /* debug purpose only. */
 };
@@ -328,8 +349,8 @@ struct gs_font_dir_s {
 #define font_dir_do_ptrs(m)\
   /*m(-,orig_fonts)*/ m(0,scaled_fonts) m(1,fmcache.mdata)\
   m(2,ccache.table) m(3,ccache.mark_glyph_data)\
-  m(4,glyph_to_unicode_table) m(5,tti) m(6,ttm) m(7,san)
-#define st_font_dir_max_ptrs 8
+  m(4,glyph_to_unicode_table) m(5,tti) m(6,ttm) m(7,san) m(8,hint_tables)
+#define st_font_dir_max_ptrs 9
 
 /* Character cache procedures (in gxccache.c and gxccman.c) */
 int gx_char_cache_alloc(gs_memory_t * struct_mem, gs_memory_t * bits_mem,
@@ -338,6 +359,8 @@ int gx_char_cache_alloc(gs_memory_t * struct_mem, gs_memory_t * bits_mem,
 void gx_char_cache_init(gs_font_dir *);
 void gx_purge_selected_cached_chars(gs_font_dir *,
                                     bool(*)(const gs_memory_t *, cached_char *, void *), void *);
+cached_char *gx_touch_cached_char(gs_font_dir *, cached_char *);
+int gx_alloc_cached_char(gs_font_dir *, uint, cached_char **);
 void gx_compute_char_matrix(const gs_matrix *char_tm, const gs_log2_scale_point *log2_scale,
     float *mxx, float *mxy, float *myx, float *myy);
 void gx_compute_ccache_key(gs_font * pfont, const gs_matrix *char_tm,
@@ -358,6 +381,15 @@ int  gx_provide_fm_pair_attributes(gs_font_dir * dir,
                bool design_grid);
 int  gx_touch_fm_pair(gs_font_dir *dir, cached_fm_pair *pair);
 
+/* Persistent glyph cache procedures (in gxccdisk.c) */
+void gx_glyph_strike_open(gs_font_dir *, cached_fm_pair *, const gs_font *,
+    bool);
+void gx_glyph_strike_close(gs_font_dir *, cached_fm_pair *);
+void gx_glyph_strike_add(gs_font_dir *, const gs_font *, cached_fm_pair *,
+    const cached_char *);
+cached_char *gx_glyph_strike_lookup(gs_font_dir *, const gs_font *,
+    cached_fm_pair *, gs_glyph, int, int, const gs_fixed_point *);
+
 void gs_clean_fm_pair(gs_font_dir * dir, cached_fm_pair * pair);
 int  gs_purge_fm_pair(gs_font_dir *, cached_fm_pair *, int);
 int  gs_purge_font_from_char_caches(gs_font *);
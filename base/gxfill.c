@@ -451,6 +451,29 @@ gx_general_fill_path(gx_device * pdev, const gs_imager_state * pis,
         if (fo.adjust_left | fo.adjust_right | fo.adjust_below | fo.adjust_above)
             fill_by_trapezoids = false; /* avoid double writing pixels */
     }
+    /*
+     * With the any-part-of-pixel rule, we may fill by coverage
+     * accumulation instead.  It doesn't need to find intersections,
+     * which pays off on paths with many segments, but costs more
+     * per scan line on simple ones.
+     */
+    /*
+     * Huge paths on memory devices may also be filled this way by
+     * several threads at once, in horizontal strips.  The trapezoid
+     * algorithm isn't threaded, so FillThreads has no effect unless
+     * CoverageFill is enabled too.
+     */
+    if (adjust.x == fixed_half && adjust.y == fixed_half && !fo.is_spotan) {
+        int min_segments = gs_currentcoveragefill(pis->memory);
+
+        if (min_segments > 0 && gx_path_has_segments(ppath, min_segments)) {
+            int threads = gs_currentfillthreads(pis->memory);
+            int nstrips = (threads > 1 ?
+                           gx_fill_path_strips(ppath, &fo, threads) : 1);
+
+            return gx_fill_path_by_coverage(ppath, &fo, nstrips);
+        }
+    }
     gx_path_init_local(&ffpath, ppath->memory);
     if (!big_path && !gx_path_has_curves(ppath))        /* don't need to flatten */
         pfpath = ppath;
@@ -1172,18 +1195,20 @@ init_al(active_line *alp, const segment *s0, const segment *s1, const line_list
         } else {
             const curve_segment *cs = (const curve_segment *)s0;
             int k = gx_curve_log2_samples(s1->pt.x, s1->pt.y, cs, ll->fo->fixed_flat);
-            bool more;
+            gs_fixed_point points[32];
+            int n, count = 0;
 
             gx_flattened_iterator__init(&alp->fi,
                 s1->pt.x, s1->pt.y, (const curve_segment *)s0, k);
-            alp->more_flattened = false;
+            /* Run to the last segment, to scan back from it. */
             do {
-                code = gx_flattened_iterator__next(&alp->fi);
+                code = gx_flattened_iterator__next_points(&alp->fi,
+                                        points, countof(points), &n);
                 if (code < 0)
                     return code;
-                more = code;
-                alp->more_flattened |= more;
-            } while(more);
+                count += n;
+            } while(code);
+            alp->more_flattened = count > 1;
             gx_flattened_iterator__switch_to_backscan(&alp->fi, alp->more_flattened);
             code = step_al(alp, false);
             if (code < 0)
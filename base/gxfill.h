@@ -108,6 +108,13 @@ typedef struct fill_options_s {
     dev_proc_fill_trapezoid((*fill_trap));
 } fill_options;
 
+/* Fill a path by scan line coverage accumulation (in gxfillcv.c). */
+int gx_fill_path_by_coverage(gx_path * ppath, const fill_options * fo,
+                             int nstrips);
+int gx_fill_path_strips(const gx_path * ppath, const fill_options * fo,
+                        int threads);
+bool gx_path_has_segments(const gx_path * ppath, int count);
+
 /* Line list structure */
 #ifndef line_list_DEFINED
 #  define line_list_DEFINED
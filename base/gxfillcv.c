@@ -0,0 +1,731 @@
+/* Copyright (C) 2001-2012 Artifex Software, Inc.
+   All Rights Reserved.
+
+   This software is provided AS-IS with no warranty, either express or
+   implied.
+
+   This software is distributed under license and may not be copied,
+   modified or distributed except as expressly authorized under the terms
+   of the license contained in the file LICENSE in this distribution.
+
+   Refer to licensing information at http://www.artifex.com or contact
+   Artifex Software, Inc.,  7 Mt. Lassen Drive - Suite A-134, San Rafael,
+   CA  94903, U.S.A., +1(415)492-9861, for further information.
+*/
+
+
+/* Scan line coverage path filling */
+#include "gx.h"
+#include "gserrors.h"
+#include "gxarith.h"
+#include "gxfixed.h"
+#include "gxdevice.h"
+#include "gzpath.h"
+#include "gxdcolor.h"
+#include "gxfdrop.h"
+#include "gxfill.h"
+#include "gxdevmem.h"
+#include "gsmchunk.h"
+#include "gpsync.h"
+#include "math_.h"
+#include "memory_.h"
+#include "stdint_.h"
+#include <stdlib.h>		/* for qsort */
+
+/*
+ * This is an alternative to the active line algorithm of gxfill.c,
+ * for the common case of filling with the any-part-of-pixel rule
+ * (fill adjust 0.5) without dropout prevention.  It is used for paths
+ * with at least as many segments as the CoverageFill user parameter.
+ *
+ * The path is reduced to straight edges, which are sorted into buckets
+ * by the first pixel row they touch.  Each row is then rasterized from
+ * the edges active in it, using two facts:
+ *
+ *      - A pixel whose cell some edge meets is painted, since the
+ *      regions on the two sides of an edge have winding numbers
+ *      differing by 1, so one of them is inside the path.  With the
+ *      rounding of gxfill.c, the cell of pixel i spans the fixed
+ *      coordinates int2fixed(i) < x <= int2fixed(i + 1) - fixed_epsilon,
+ *      and likewise in Y, so an edge lying on a pixel boundary touches
+ *      only the pixels on one side of it.
+ *
+ *      - Any other pixel has a constant winding number, the sum of the
+ *      directions of the edges crossing the row's center line to its
+ *      left.
+ *
+ * gxfill.c also splits the edges into bands at every vertex and every
+ * crossing of the path, and paints each band from the X of the edges at
+ * its top rounded down; we add the pixels this reaches.  gxfill.c finds
+ * the crossings from rounded coordinates, so a pixel next to one may
+ * still come out differently.
+ *
+ * Both are accumulated as events at pixel boundaries, which are sorted
+ * and swept once per row, so the work depends on the number of edges
+ * in the row rather than on its width.  Rows producing the same spans
+ * are merged into rectangles.  The crossings are only noted where two
+ * edges change places from one row to the next, whereas ordering them
+ * is where the trapezoid algorithm spends most of its time on maps and
+ * charts.  On the other hand every row costs a sort and a sweep, where
+ * a trapezoid costs little more than its rectangles, so simple paths
+ * are better left to gxfill.c.
+ */
+
+typedef struct cov_edge_s {
+    fixed x0, y0, x1, y1;	/* y0 <= y1 */
+    int dir;			/* DIR_UP, DIR_DOWN or DIR_HORIZONTAL */
+    int next;			/* next edge in the same bucket, or -1 */
+    /*
+     * While the edge is active, X at the top, the center and the bottom
+     * sampling lines of the current row (see cov_fill_edges) is tracked
+     * exactly as x0 + q + r / (y1 - y0), stepping by dq + dr / (y1 - y0)
+     * per row.  Edges too long for this fall back to cov_x_at_y.
+     */
+    bool slow;
+    fixed xt;			/* X at the top of the current row */
+    fixed lo, hi;		/* X extent in the current row */
+    int64_t qt, qm, qb, dq;
+    fixed rt, rm, rb, dr;
+} cov_edge;
+
+typedef struct cov_event_s {
+    int x;			/* pixel boundary */
+    short touch;		/* +1 starts, -1 ends edge pixels */
+    short wind;			/* winding number change */
+} cov_event;
+
+typedef struct cov_span_s {
+    int x0, x1;
+} cov_span;
+
+/* Compute the X coordinate of an edge at a given Y, rounding down or up. */
+static fixed
+cov_x_at_y(const cov_edge *pe, fixed y, bool up)
+{
+    fixed dx = pe->x1 - pe->x0, dy = pe->y1 - pe->y0;
+    int64_t num, q;
+
+    if (y <= pe->y0)
+        return pe->x0;
+    if (y >= pe->y1)
+        return pe->x1;
+    if (any_abs(dx) >= max_fixed / 2) {
+        double x = (double)dx * (y - pe->y0) / dy;
+
+        return pe->x0 + (fixed)(up ? ceil(x) : floor(x));
+    }
+    num = (int64_t)dx * (y - pe->y0);
+    q = num / dy;
+    if (q * dy != num) {
+        if (num < 0)
+            q--;
+        if (up)
+            q++;
+    }
+    return pe->x0 + (fixed)q;
+}
+
+/*
+ * Start tracking an edge at the given Y, which may lie outside the edge:
+ * the values are only used where they are in range.
+ */
+static void
+cov_dda_start(cov_edge *pe, fixed y, int64_t *pq, fixed *pr)
+{
+    fixed dy = pe->y1 - pe->y0;
+    int64_t num = (int64_t)(pe->x1 - pe->x0) * (y - pe->y0);
+    int64_t q = num / dy, r = num - q * dy;
+
+    if (r < 0)
+        q--, r += dy;
+    *pq = q, *pr = (fixed)r;
+}
+
+/*
+ * Find where two edges cross, rounding Y down.  Return false if they are
+ * parallel or don't cross inside both of them.
+ */
+static bool
+cov_cross_y(const cov_edge *pe, const cov_edge *pf, fixed *py)
+{
+    double se, sf, t;
+
+    if (pe->dir == DIR_HORIZONTAL || pf->dir == DIR_HORIZONTAL)
+        return false;
+    se = (double)(pe->x1 - pe->x0) / (pe->y1 - pe->y0);
+    sf = (double)(pf->x1 - pf->x0) / (pf->y1 - pf->y0);
+    if (se == sf)
+        return false;
+    t = floor(((double)(pf->x0 - pe->x0) +
+               (double)(pe->y0 - pf->y0) * sf) / (se - sf));
+    if (t <= 0 || t >= (double)(pe->y1 - pe->y0) ||
+        pe->y0 + (fixed)t <= pf->y0 || pe->y0 + (fixed)t >= pf->y1)
+        return false;
+    *py = pe->y0 + (fixed)t;
+    return true;
+}
+
+/* Advance an edge by one row. */
+#define COV_DDA_STEP(pe, q, r)\
+  BEGIN\
+    (q) += (pe)->dq;\
+    if (((r) += (pe)->dr) >= (pe)->y1 - (pe)->y0)\
+        (r) -= (pe)->y1 - (pe)->y0, (q)++;\
+  END
+
+/*
+ * Sort events by X.  The active edges are kept in X order, so the events
+ * arrive nearly sorted, and insertion sort is linear in practice.
+ */
+static void
+cov_sort_events(cov_event *ev, int n)
+{
+    int i, k;
+
+    for (i = 1; i < n; i++) {
+        cov_event e;
+
+        if (ev[i].x >= ev[i - 1].x)
+            continue;
+        e = ev[i];
+        for (k = i; k > 0 && ev[k - 1].x > e.x; k--)
+            ev[k] = ev[k - 1];
+        ev[k] = e;
+    }
+}
+
+static int
+cov_compare_y(const void *p1, const void *p2)
+{
+    fixed y1 = *(const fixed *)p1, y2 = *(const fixed *)p2;
+
+    return (y1 < y2 ? -1 : y1 > y2 ? 1 : 0);
+}
+
+/* Count the edges of a path, including implicit closing lines. */
+static int
+cov_count_edges(const gx_path *ppath)
+{
+    const subpath *psub;
+    int count = 0;
+
+    for (psub = ppath->first_subpath; psub != 0;
+         psub = (const subpath *)psub->last->next) {
+        const segment *pseg;
+
+        for (pseg = psub->next; pseg != 0 && pseg->type != s_start;
+             pseg = pseg->next)
+            count++;
+        count++;
+    }
+    return count;
+}
+
+/* Check whether a path has at least a given number of segments. */
+bool
+gx_path_has_segments(const gx_path * ppath, int count)
+{
+    const segment *pseg;
+
+    for (pseg = (const segment *)ppath->first_subpath; pseg != 0;
+         pseg = pseg->next)
+        if (--count <= 0)
+            return true;
+    return false;
+}
+
+#define FILL_DIRECT fo->fill_direct
+
+/* Emit the pending spans as rectangles of the given height. */
+static int
+cov_flush_spans(const fill_options *fo, const cov_span *spans, int count,
+                int y, int h)
+{
+    int i, code;
+
+    for (i = 0; i < count; i++) {
+        code = LOOP_FILL_RECTANGLE_DIRECT(fo, spans[i].x0, y,
+                                          spans[i].x1 - spans[i].x0, h);
+        if (code < 0)
+            return code;
+    }
+    return 0;
+}
+
+static int
+cov_fill_edges(const gx_path *ppath, const fill_options *fo, gs_memory_t *mem)
+{
+    const int row0 = fixed2int(fo->pbox->p.y);
+    const int row1 = fixed2int_ceiling(fo->pbox->q.y);
+    const int xmin = fixed2int(fo->pbox->p.x);
+    const int xmax = fixed2int_ceiling(fo->pbox->q.x);
+    const int rule = fo->rule;
+    int nrows = row1 - row0;
+    int max_edges = cov_count_edges(ppath);
+    int max_events = max_edges * 3;
+    int nedges = 0, nactive = 0, nys = 0, iy = 0;
+    cov_edge *edges;
+    int *buckets, *active;
+    fixed *ys, *xs;
+    cov_event *events;
+    cov_span *spans, *pending;
+    int npending = 0, pending_y = row0;
+    byte *data;
+    uint size;
+    const subpath *psub;
+    int j, code = 0;
+
+    if (nrows <= 0 || xmax <= xmin || max_edges == 0)
+        return 0;
+    size = max_edges * (sizeof(cov_edge) + sizeof(int) + 2 * sizeof(fixed)) +
+        nrows * sizeof(int) +
+        max_events * sizeof(cov_event) +
+        (max_events + 1) * 2 * sizeof(cov_span);
+    data = gs_alloc_bytes(mem, size, "cov_fill_edges");
+    if (data == 0)
+        return_error(gs_error_VMerror);
+    edges = (cov_edge *)data;
+    events = (cov_event *)(edges + max_edges);
+    spans = (cov_span *)(events + max_events);
+    pending = spans + max_events + 1;
+    buckets = (int *)(pending + max_events + 1);
+    active = buckets + nrows;
+    ys = (fixed *)(active + max_edges);
+    xs = ys + max_edges;
+    for (j = 0; j < nrows; j++)
+        buckets[j] = -1;
+
+    /* Collect the edges into buckets by first row. */
+    for (psub = ppath->first_subpath; psub != 0;
+         psub = (const subpath *)psub->last->next) {
+        const segment *pseg = (const segment *)psub;
+        gs_fixed_point p0, p1;
+        bool done = false;
+
+        p1 = psub->pt;
+        while (!done) {
+            cov_edge *pe;
+            int first, last;
+
+            p0 = p1;
+            pseg = pseg->next;
+            if (pseg == 0 || pseg->type == s_start) {
+                p1 = psub->pt;	/* close the subpath */
+                done = true;
+            } else
+                p1 = pseg->pt;
+            if (p0.x == p1.x && p0.y == p1.y)
+                continue;
+            /* Vertices on row boundaries don't matter (see below). */
+            if (fixed_fraction(p1.y) != 0)
+                ys[nys++] = p1.y;
+            pe = &edges[nedges];
+            if (p0.y <= p1.y) {
+                pe->x0 = p0.x, pe->y0 = p0.y, pe->x1 = p1.x, pe->y1 = p1.y;
+                pe->dir = (p0.y < p1.y ? DIR_UP : DIR_HORIZONTAL);
+            } else {
+                pe->x0 = p1.x, pe->y0 = p1.y, pe->x1 = p0.x, pe->y1 = p0.y;
+                pe->dir = DIR_DOWN;
+            }
+            if (pe->dir == DIR_HORIZONTAL) {
+                /* Only touches pixels if it isn't on a row boundary. */
+                if (fixed_fraction(pe->y0) == 0)
+                    continue;
+                first = last = fixed2int(pe->y0);
+            } else {
+                first = fixed2int(pe->y0);
+                last = fixed2int_ceiling(pe->y1) - 1;
+            }
+            if (last < row0 || first >= row1)
+                continue;
+            if (first < row0)
+                first = row0;
+            pe->next = buckets[first - row0];
+            buckets[first - row0] = nedges++;
+        }
+    }
+
+    qsort(ys, nys, sizeof(fixed), cov_compare_y);
+
+    for (j = row0; j < row1; j++) {
+        const fixed yt = int2fixed(j);
+        const fixed ym = yt + fixed_half;
+        const fixed yb = yt + fixed_1 - fixed_epsilon;
+        const cov_event *ev = events;
+        int nev = 0, nspans = 0;
+        int i, k, touch, wind, ny, nxs = 0;
+
+        /* Find the vertices inside the row. */
+        while (iy < nys && ys[iy] <= yt)
+            iy++;
+        for (ny = 0; iy + ny < nys && ys[iy + ny] < yt + fixed_1; ny++)
+            DO_NOTHING;
+
+        /* Retire the edges that ended, and add the new ones. */
+        for (i = k = 0; i < nactive; i++)
+            if (edges[active[i]].y1 > yt)
+                active[k++] = active[i];
+        nactive = k;
+        for (i = buckets[j - row0]; i >= 0; i = edges[i].next) {
+            cov_edge *pe = &edges[i];
+
+            active[nactive++] = i;
+            if (pe->dir == DIR_HORIZONTAL) {
+                pe->xt = min(pe->x0, pe->x1);
+                continue;
+            }
+            pe->xt = cov_x_at_y(pe, yt, false);
+            pe->slow = any_abs(pe->x1 - pe->x0) >= max_fixed / 2 ||
+                any_abs(yt - pe->y0) >= max_fixed / 2;
+            if (!pe->slow) {
+                int64_t num = (int64_t)(pe->x1 - pe->x0) * fixed_1;
+                fixed dy = pe->y1 - pe->y0;
+
+                pe->dq = num / dy;
+                if (num - pe->dq * dy < 0)
+                    pe->dq--;
+                pe->dr = (fixed)(num - pe->dq * dy);
+                cov_dda_start(pe, yt, &pe->qt, &pe->rt);
+                cov_dda_start(pe, ym, &pe->qm, &pe->rm);
+                cov_dda_start(pe, yb, &pe->qb, &pe->rb);
+            }
+        }
+        if (nactive == 0) {
+            if (npending) {
+                code = cov_flush_spans(fo, pending, npending, pending_y,
+                                       j - pending_y);
+                if (code < 0)
+                    break;
+                npending = 0;
+            }
+            continue;
+        }
+
+        /*
+         * Put the new edges in X order among the others, which were
+         * ordered at the end of the previous row.
+         */
+        for (i = 1; i < nactive; i++) {
+            int e = active[i];
+            fixed x = edges[e].xt;
+
+            for (k = i; k > 0 && edges[active[k - 1]].xt > x; k--)
+                active[k] = active[k - 1];
+            active[k] = e;
+        }
+
+        /*
+         * Find the X extent of each edge in the row, and accumulate
+         * the winding events.  An edge touches the pixels whose cells it
+         * meets between the row's top line and its bottom line, the last
+         * fixed Y in the row: although the top line belongs to the row
+         * above, gxfill.c paints this row from the X of the edge there
+         * too.  The ends of the X extent are rounded up, since the cells
+         * are closed on the right.
+         */
+        for (i = 0; i < nactive; i++) {
+            cov_edge *pe = &edges[active[i]];
+            fixed lo, hi, xm = 0;
+            bool crosses = false;
+
+            if (pe->dir == DIR_HORIZONTAL) {
+                lo = pe->x0, hi = pe->x1;
+                if (lo > hi)
+                    lo = pe->x1, hi = pe->x0;
+            } else {
+                fixed xtop, xbot;
+
+                if (pe->y0 >= yt || pe->x0 == pe->x1)
+                    xtop = pe->x0;
+                else if (pe->slow)
+                    xtop = cov_x_at_y(pe, yt, true);
+                else
+                    xtop = pe->x0 + (fixed)pe->qt + (pe->rt != 0);
+                if (pe->y1 <= yb)
+                    xbot = pe->x1;
+                else if (pe->slow)
+                    xbot = cov_x_at_y(pe, yb, true);
+                else
+                    xbot = pe->x0 + (fixed)pe->qb + (pe->rb != 0);
+                if (pe->slow) {
+                    xm = cov_x_at_y(pe, ym, false);
+                    pe->xt = cov_x_at_y(pe, yt + fixed_1, false);
+                } else {
+                    xm = pe->x0 + (fixed)pe->qm;
+                    COV_DDA_STEP(pe, pe->qt, pe->rt);
+                    COV_DDA_STEP(pe, pe->qm, pe->rm);
+                    COV_DDA_STEP(pe, pe->qb, pe->rb);
+                    pe->xt = pe->x0 + (fixed)pe->qt;
+                }
+                if (pe->x1 < pe->x0)
+                    lo = xbot, hi = xtop;
+                else
+                    lo = xtop, hi = xbot;
+                crosses = (pe->y0 <= ym && ym < pe->y1);
+            }
+            pe->lo = lo, pe->hi = hi;
+            if (crosses) {
+                events[nev].x = max(min(fixed2int_ceiling(xm), xmax), xmin);
+                events[nev].touch = 0;
+                events[nev].wind = pe->dir;
+                nev++;
+            }
+        }
+
+        /*
+         * Put the edges in X order at the top of the next row, noting
+         * where two of them cross inside this row.
+         */
+        for (i = 1; i < nactive; i++) {
+            int e = active[i];
+            fixed x = edges[e].xt;
+
+            for (k = i; k > 0 && edges[active[k - 1]].xt > x; k--) {
+                fixed y;
+
+                active[k] = active[k - 1];
+                if (nxs < max_edges &&
+                    cov_cross_y(&edges[e], &edges[active[k - 1]], &y) &&
+                    y > yt && y < yt + fixed_1 && fixed_fraction(y) != 0)
+                    xs[nxs++] = y;
+            }
+            active[k] = e;
+        }
+
+        /*
+         * Emit the extents, adding the pixels that gxfill.c reaches by
+         * rounding X down at the vertices and crossings inside the row.
+         * Since the extent has X rounded up, this can only happen where
+         * it starts on a pixel boundary.
+         */
+        for (i = 0; i < nactive; i++) {
+            cov_edge *pe = &edges[active[i]];
+            int a = fixed2int(pe->lo), b;
+
+            if (ny + nxs > 0 && fixed_fraction(pe->lo) == 0 &&
+                pe->dir != DIR_HORIZONTAL && pe->x0 != pe->x1) {
+                for (k = 0; k < ny + nxs; k++) {
+                    fixed y = (k < ny ? ys[iy + k] : xs[k - ny]), xf;
+
+                    if (y <= pe->y0 || y >= pe->y1)
+                        continue;
+                    xf = cov_x_at_y(pe, y, false);
+                    if (fixed_fraction(xf + fixed_epsilon) == 0 &&
+                        fixed2int(xf) < a)
+                        a = fixed2int(xf);
+                }
+            }
+            a = max(a, xmin);
+            b = min(fixed2int_ceiling(pe->hi), xmax);
+            if (a < b) {
+                events[nev].x = a;
+                events[nev].touch = 1;
+                events[nev].wind = 0;
+                nev++;
+                events[nev].x = b;
+                events[nev].touch = -1;
+                events[nev].wind = 0;
+                nev++;
+            }
+        }
+
+        /* Sweep the events, collecting the spans to paint. */
+        cov_sort_events(events, nev);
+        touch = wind = 0;
+        for (i = 0; i < nev;) {
+            int x = ev[i].x;
+
+            do {
+                touch += ev[i].touch;
+                wind += ev[i].wind;
+                i++;
+            } while (i < nev && ev[i].x == x);
+            if (i < nev && ev[i].x > x && (touch > 0 || (wind & rule) != 0)) {
+                if (nspans > 0 && spans[nspans - 1].x1 == x)
+                    spans[nspans - 1].x1 = ev[i].x;
+                else {
+                    spans[nspans].x0 = x;
+                    spans[nspans].x1 = ev[i].x;
+                    nspans++;
+                }
+            }
+        }
+
+        /* Merge with the previous rows if the spans are the same. */
+        if (nspans == npending &&
+            !memcmp(spans, pending, nspans * sizeof(cov_span)))
+            continue;
+        if (npending) {
+            code = cov_flush_spans(fo, pending, npending, pending_y,
+                                   j - pending_y);
+            if (code < 0)
+                break;
+        }
+        {
+            cov_span *t = pending;
+
+            pending = spans, spans = t;
+        }
+        npending = nspans;
+        pending_y = j;
+    }
+    if (code >= 0 && npending)
+        code = cov_flush_spans(fo, pending, npending, pending_y,
+                               row1 - pending_y);
+    gs_free_object(mem, data, "cov_fill_edges");
+    return code;
+}
+
+#undef FILL_DIRECT
+
+/* ---------------- Filling in strips ---------------- */
+
+/*
+ * A huge path on a memory device may be filled by several threads, each
+ * rasterizing the rows of one horizontal strip of the path's bounding box.
+ * Strips write disjoint scan lines, and nothing else is shared except the
+ * path, which is only read; each thread has its own chunk allocator.
+ * We only do this where that is really true: pure colors drawn straight
+ * into a chunky memory device, not through a clipping device, halftone
+ * or RasterOp.  The strips are rasterized exactly as the whole path would
+ * be, so FillThreads (which gxfill.c only consults for paths that
+ * CoverageFill already sends here) never changes the output.
+ */
+
+/* Don't bother with paths of fewer segments or strips of fewer rows. */
+#define COV_STRIP_MIN_SEGMENTS 100
+#define COV_STRIP_MIN_ROWS 64
+
+typedef struct cov_strip_s {
+    const gx_path *ppath;
+    fill_options fo;
+    gs_fixed_rect box;
+    gs_memory_t *memory;
+    gp_thread_id thread;
+    int code;
+} cov_strip;
+
+static void
+cov_fill_strip(void *arg)
+{
+    cov_strip *ps = (cov_strip *)arg;
+
+    ps->code = cov_fill_edges(ps->ppath, &ps->fo, ps->memory);
+}
+
+/*
+ * Return the number of strips to fill a path in with up to the given
+ * number of threads, 1 if it isn't worth it or can't be done.
+ */
+int
+gx_fill_path_strips(const gx_path * ppath, const fill_options * fo,
+                    int threads)
+{
+    gx_device *dev = fo->dev;
+    gs_memory_t *mem = ppath->memory;
+    gs_memory_status_t mem_status;
+    int rows = fixed2int_ceiling(fo->pbox->q.y) - fixed2int(fo->pbox->p.y);
+
+    /* Don't start more threads than there are processors to run them. */
+    if (threads > gp_get_cpu_count())
+        threads = gp_get_cpu_count();
+    if (threads > rows / COV_STRIP_MIN_ROWS)
+        threads = rows / COV_STRIP_MIN_ROWS;
+    if (threads < 2 || fo->is_spotan || !fo->fill_direct ||
+        !gs_device_is_memory(dev) ||
+        ((const gx_device_memory *)dev)->num_planes != 0 ||
+        !gx_path_has_segments(ppath, COV_STRIP_MIN_SEGMENTS))
+        return 1;
+    /* The chunk allocators need a thread-safe base allocator. */
+    gs_memory_status(mem->thread_safe_memory, &mem_status);
+    if (!mem_status.is_thread_safe)
+        return 1;
+    return threads;
+}
+
+static int
+cov_fill_in_strips(const gx_path * ppath, const fill_options * fo,
+                   int nstrips)
+{
+    gs_memory_t *mem = ppath->memory;
+    const int row0 = fixed2int(fo->pbox->p.y);
+    const int rows = fixed2int_ceiling(fo->pbox->q.y) - row0;
+    cov_strip *strips;
+    int i, code = 0;
+
+    strips = (cov_strip *)gs_alloc_byte_array(mem, nstrips, sizeof(cov_strip),
+                                              "cov_fill_in_strips");
+    if (strips == 0)
+        return_error(gs_error_VMerror);
+    for (i = 0; i < nstrips; i++) {
+        cov_strip *ps = &strips[i];
+
+        ps->ppath = ppath;
+        ps->fo = *fo;
+        ps->fo.pbox = &ps->box;
+        ps->box = *fo->pbox;
+        if (i > 0)
+            ps->box.p.y = int2fixed(row0 + (int)((long)rows * i / nstrips));
+        if (i < nstrips - 1)
+            ps->box.q.y = int2fixed(row0 + (int)((long)rows * (i + 1) / nstrips));
+        ps->memory = 0;
+        ps->thread = 0;
+        ps->code = 0;
+        if (i > 0 &&
+            gs_memory_chunk_wrap(&ps->memory, mem->thread_safe_memory) >= 0 &&
+            gp_thread_start(cov_fill_strip, ps, &ps->thread) < 0)
+            ps->thread = 0;
+    }
+    /* Strips whose thread didn't start are filled here. */
+    strips[0].memory = mem;
+    cov_fill_strip(&strips[0]);
+    for (i = 1; i < nstrips; i++) {
+        cov_strip *ps = &strips[i];
+
+        if (ps->thread != 0)
+            gp_thread_finish(ps->thread);
+        else {
+            if (ps->memory == 0)
+                ps->memory = mem;
+            cov_fill_strip(ps);
+        }
+        if (ps->memory != mem)
+            gs_memory_chunk_release(ps->memory);
+    }
+    for (i = 0; i < nstrips && code >= 0; i++)
+        code = strips[i].code;
+    gs_free_object(mem, strips, "cov_fill_in_strips");
+    return code;
+}
+
+/*
+ * Fill a path with the any-part-of-pixel rule, by coverage accumulation,
+ * in the given number of strips (see gx_fill_path_strips).  fo->pbox must
+ * bound the pixels to paint.
+ */
+int
+gx_fill_path_by_coverage(gx_path * ppath, const fill_options * fo,
+                         int nstrips)
+{
+    const gx_path *pfpath = ppath;
+    gx_path ffpath;
+    int code;
+
+    if (gx_path_has_curves(ppath)) {
+        gx_path_init_local(&ffpath, ppath->memory);
+        code = gx_path_copy_reducing(ppath, &ffpath, fo->fixed_flat, NULL,
+                                     pco_none);
+        if (code < 0) {
+            gx_path_free(&ffpath, "gx_fill_path_by_coverage");
+            return code;
+        }
+        pfpath = &ffpath;
+    }
+    if (nstrips > 1)
+        code = cov_fill_in_strips(pfpath, fo, nstrips);
+    else
+        code = cov_fill_edges(pfpath, fo, ppath->memory);
+    if (pfpath != ppath)
+        gx_path_free(&ffpath, "gx_fill_path_by_coverage");
+    return code;
+}
@@ -141,6 +141,8 @@ struct gs_type1_data_s {
     float_array(max_WeightVector) WeightVector;
     byte hash_subrs[16];	/* Used only for checking font copying compatibility */
     int num_subrs;		/* Used only for checking font copying compatibility */
+    bool client_OtherSubrs;	/* an OtherSubr was left to the client, */
+                                /* see gxccdisk.c */
 };
 
 #define gs_type1_data_s_DEFINED
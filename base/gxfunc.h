@@ -44,6 +44,9 @@ int fn_check_mnDR(const gs_function_params_t * params, int m, int n);
 /* Generic get_info implementation (no Functions or DataSource). */
 FN_GET_INFO_PROC(gs_function_get_info_default);
 
+/* Generic evaluate_batch implementation (one point at a time). */
+FN_EVALUATE_BATCH_PROC(gs_function_evaluate_batch_default);
+
 /*
  * Write generic parameters (FunctionType, Domain, Range) on a parameter list.
  */
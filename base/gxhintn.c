@@ -27,6 +27,7 @@
 #include "gxfont.h"
 #include "gxfont1.h"
 #include "gxtype1.h"
+#include "gxfcache.h"
 #include "gxhintn.h"
 #include "gzpath.h"
 #include "gserrors.h"
@@ -775,9 +776,11 @@ static bool t1_hinter__realloc_array(gs_memory_t *mem, void **a, void *a0, int *
 static int t1_hinter__set_alignment_zones(t1_hinter * self, float * blues, int count, enum t1_zone_type type, bool family)
 {   int count2 = count / 2, i, j;
 
+    if (count2 <= 0)
+        return 0; /* BlueValues may have less than 2 elements. */
     if (!family) {
         /* Store zones : */
-        if (count2 + self->zone_count >= self->max_zone_count)
+        if (count2 + self->zone_count > self->max_zone_count)
             if(t1_hinter__realloc_array(self->memory, (void **)&self->zone, self->zone0, &self->max_zone_count,
                                         sizeof(self->zone0) / count_of(self->zone0),
                                         max(T1_MAX_ALIGNMENT_ZONES, count), s_zone_array))
@@ -802,34 +805,31 @@ static int t1_hinter__set_alignment_zones(t1_hinter * self, float * blues, int c
 }
 
 static int t1_hinter__set_stem_snap(t1_hinter * self, float * value, int count, unsigned short hv)
-{   int count0 = self->stem_snap_count[hv], i, j;
+{   int i, j;
     t1_glyph_space_coord pixel_g = (!hv ? self->pixel_gh : self->pixel_gw);
 
     if (pixel_g == 0)
         return 0;
-    if (count + count0 >= self->max_stem_snap_count[hv])
+    if (count >= self->max_stem_snap_count[hv])
         if(t1_hinter__realloc_array(self->memory, (void **)&self->stem_snap[hv], self->stem_snap0[hv], &self->max_stem_snap_count[hv],
                                         sizeof(self->stem_snap0[0]) / count_of(self->stem_snap0[0]),
                                         max(T1_MAX_STEM_SNAPS, count), s_stem_snap_array))
             return_error(gs_error_VMerror);
-    if (count + count0 >= self->max_stem_snap_vote_count)
+    if (count >= self->max_stem_snap_vote_count)
         if(t1_hinter__realloc_array(self->memory, (void **)&self->stem_snap_vote, self->stem_snap_vote0, &self->max_stem_snap_vote_count,
                                         sizeof(self->stem_snap_vote0) / count_of(self->stem_snap_vote0),
                                         max(T1_MAX_STEM_SNAPS, count), s_stem_snap_vote_array))
             return_error(gs_error_VMerror);
     if (count == 1 || (count > 0 && float2fixed(value[count - 1] - value[0]) > pixel_g)) {
-        for (i = 0; i < count; i++)
-            self->stem_snap[hv][i] = float2fixed(value[i]);
-        self->stem_snap_count[hv] = count;
+        /* Insertion sort, the arrays are short and usually ordered : */
         for (i = 0; i < count; i++) {
-            for (j = i + 1; j < count; j++)
-                if (self->stem_snap[hv][i] > self->stem_snap[hv][j]) {
-                    t1_glyph_space_coord v = self->stem_snap[hv][i];
+            t1_glyph_space_coord v = float2fixed(value[i]);
 
-                    self->stem_snap[hv][i] = self->stem_snap[hv][j];
-                    self->stem_snap[hv][j] = v;
-                }
+            for (j = i; j > 0 && self->stem_snap[hv][j - 1] > v; j--)
+                self->stem_snap[hv][j] = self->stem_snap[hv][j - 1];
+            self->stem_snap[hv][j] = v;
         }
+        self->stem_snap_count[hv] = count;
         for (i = 1, j = 0; i < count; i++) {
             if (self->stem_snap[hv][j] != self->stem_snap[hv][i]) {
                 j++;
@@ -870,8 +870,83 @@ static void enable_draw_import(void)
     vd_setlinewidth(0);
 }
 
-int t1_hinter__set_font_data(t1_hinter * self, int FontType, gs_type1_data *pdata, bool no_grid_fitting, bool is_resource)
-{   int code;
+static t1_hint_tables *t1_hinter__find_hint_tables(t1_hinter * self, gs_font_dir *dir, gs_id font_id)
+{   int i;
+
+    if (dir == NULL || dir->hint_tables == NULL)
+        return NULL;
+    for (i = 0; i < T1_HINT_TABLES_CACHE_SIZE; i++) {
+        t1_hint_tables *t = &dir->hint_tables[i];
+
+        if (t->font_id == font_id &&
+                t->heigt_transform_coef == self->heigt_transform_coef &&
+                t->pixel_gh == self->pixel_gh && t->pixel_gw == self->pixel_gw &&
+                t->max_import_coord == self->max_import_coord)
+            return t;
+    }
+    return NULL;
+}
+
+static void t1_hinter__load_hint_tables(t1_hinter * self, gs_font_dir *dir, t1_hint_tables *t)
+{   int hv;
+
+    t->stamp = ++dir->hint_tables_stamp;
+    memcpy(self->zone, t->zone, t->zone_count * sizeof(t->zone[0]));
+    self->zone_count = t->zone_count;
+    for (hv = 0; hv < 2; hv++) {
+        memcpy(self->stem_snap[hv], t->stem_snap[hv], t->stem_snap_count[hv] * sizeof(t->stem_snap[hv][0]));
+        self->stem_snap_count[hv] = t->stem_snap_count[hv];
+    }
+    /* Reproduce the precision adjustment made while importing the zones. */
+    if (t->result_max_import_coord > self->max_import_coord) {
+        fixed c = (fixed)(t->result_max_import_coord >> 1);
+
+        t1_hinter__adjust_matrix_precision(self, c, c);
+    }
+}
+
+static void t1_hinter__store_hint_tables(t1_hinter * self, gs_font_dir *dir, gs_id font_id,
+                const t1_hint_tables *key)
+{   gs_memory_t *mem;
+    t1_hint_tables *t;
+    int i, hv;
+
+    /* Short BlueValues arrays can leave zone_count negative. */
+    if (dir == NULL || self->zone_count < 0 ||
+            self->zone_count > T1_MAX_ALIGNMENT_ZONES ||
+            self->stem_snap_count[0] > T1_MAX_STEM_SNAPS + 1 ||
+            self->stem_snap_count[1] > T1_MAX_STEM_SNAPS + 1)
+        return;
+    if (dir->hint_tables == NULL) {
+        mem = dir->memory->stable_memory;
+        dir->hint_tables = (t1_hint_tables *)gs_alloc_bytes(mem,
+                sizeof(t1_hint_tables) * T1_HINT_TABLES_CACHE_SIZE, "t1_hinter__store_hint_tables");
+        if (dir->hint_tables == NULL)
+            return;
+        memset(dir->hint_tables, 0, sizeof(t1_hint_tables) * T1_HINT_TABLES_CACHE_SIZE);
+    }
+    /* Replace the least recently used slot : */
+    t = &dir->hint_tables[0];
+    for (i = 1; i < T1_HINT_TABLES_CACHE_SIZE; i++)
+        if (dir->hint_tables[i].stamp < t->stamp)
+            t = &dir->hint_tables[i];
+    *t = *key;
+    t->font_id = font_id;
+    t->stamp = ++dir->hint_tables_stamp;
+    t->result_max_import_coord = self->max_import_coord;
+    memcpy(t->zone, self->zone, self->zone_count * sizeof(t->zone[0]));
+    t->zone_count = self->zone_count;
+    for (hv = 0; hv < 2; hv++) {
+        memcpy(t->stem_snap[hv], self->stem_snap[hv], self->stem_snap_count[hv] * sizeof(t->stem_snap[hv][0]));
+        t->stem_snap_count[hv] = self->stem_snap_count[hv];
+    }
+}
+
+int t1_hinter__set_font_data(t1_hinter * self, int FontType, gs_font_type1 *pfont, bool no_grid_fitting)
+{   gs_type1_data *pdata = &pfont->data;
+    bool is_resource = pfont->is_resource;
+    t1_hint_tables key, *tables;
+    int code;
 
     t1_hinter__init_outline(self);
     self->FontType = FontType;
@@ -891,6 +966,15 @@ int t1_hinter__set_font_data(t1_hinter * self, int FontType, gs_type1_data *pdat
         enable_draw_import();
     if (self->pass_through)
         return 0;
+    tables = t1_hinter__find_hint_tables(self, pfont->dir, pfont->id);
+    if (tables != NULL) {
+        t1_hinter__load_hint_tables(self, pfont->dir, tables);
+        return 0;
+    }
+    key.heigt_transform_coef = self->heigt_transform_coef;
+    key.pixel_gh = self->pixel_gh;
+    key.pixel_gw = self->pixel_gw;
+    key.max_import_coord = self->max_import_coord;
     code = t1_hinter__set_alignment_zones(self, pdata->OtherBlues.values, pdata->OtherBlues.count, botzone, false);
     if (code >= 0)
         code = t1_hinter__set_alignment_zones(self, pdata->BlueValues.values, min(2, pdata->BlueValues.count), botzone, false);
@@ -910,6 +994,8 @@ int t1_hinter__set_font_data(t1_hinter * self, int FontType, gs_type1_data *pdat
         code = t1_hinter__set_stem_snap(self, pdata->StemSnapH.values, pdata->StemSnapH.count, 0);
     if (code >= 0)
         code = t1_hinter__set_stem_snap(self, pdata->StemSnapV.values, pdata->StemSnapV.count, 1);
+    if (code >= 0)
+        t1_hinter__store_hint_tables(self, pfont->dir, pfont->id, &key);
     return code;
 }
 
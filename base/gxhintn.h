@@ -26,6 +26,11 @@
 typedef struct gs_type1_data_s gs_type1_data;
 #endif
 
+#ifndef gs_font_type1_DEFINED
+#  define gs_font_type1_DEFINED
+typedef struct gs_font_type1_s gs_font_type1;
+#endif
+
 #ifndef gs_type42_data_DEFINED
 #define gs_type42_data_DEFINED
 typedef struct gs_type42_data_s gs_type42_data;
@@ -37,7 +42,7 @@ typedef struct gx_path_s gx_path;
 #endif
 
 #define T1_MAX_STEM_SNAPS 12
-#define T1_MAX_ALIGNMENT_ZONES 6
+#define T1_MAX_ALIGNMENT_ZONES 12 /* BlueValues + OtherBlues */
 #define T1_MAX_CONTOURS 10
 #define T1_MAX_SUBGLYPHS 3
 #define T1_MAX_POLES (100 + T1_MAX_CONTOURS) /* Must be grater than 8 for 'flex'. */
@@ -114,6 +119,31 @@ typedef struct t1_zone_s /* alignment zone */
     t1_glyph_space_coord y_min, y_max;
 } t1_zone;
 
+/* Alignment zones and stem snaps of a font processed for a transformation.
+   The font directory keeps a few of them, so that glyphs of the same font
+   at the same size don't convert and sort them again. */
+#ifndef t1_hint_tables_DEFINED
+#  define t1_hint_tables_DEFINED
+typedef struct t1_hint_tables_s t1_hint_tables;
+#endif
+
+struct t1_hint_tables_s
+{   gs_id font_id; /* 0 for an empty slot */
+    uint stamp;
+    /* The hinter state the tables depend on : */
+    double heigt_transform_coef;
+    t1_glyph_space_coord pixel_gh, pixel_gw;
+    unsigned long max_import_coord;
+    /* The tables and the precision they need : */
+    unsigned long result_max_import_coord;
+    int zone_count;
+    t1_zone zone[T1_MAX_ALIGNMENT_ZONES];
+    int stem_snap_count[2];
+    t1_glyph_space_coord stem_snap[2][T1_MAX_STEM_SNAPS + 1];
+};
+
+#define T1_HINT_TABLES_CACHE_SIZE 8
+
 typedef struct t1_hinter_s
 {   fraction_matrix ctmf;
     fraction_matrix ctmi;
@@ -190,8 +220,8 @@ int  t1_hinter__set_mapping(t1_hinter * this, gs_matrix_fixed * ctm,
                         int log2_pixels_x, int log2_pixels_y,
                         int log2_subpixels_x, int log2_subpixels_y,
                         fixed origin_x, fixed origin_y, bool align_to_pixels);
-int  t1_hinter__set_font_data(t1_hinter * this, int FontType, gs_type1_data *pdata,
-                        bool no_grid_fitting, bool is_resource);
+int  t1_hinter__set_font_data(t1_hinter * this, int FontType, gs_font_type1 *pfont,
+                        bool no_grid_fitting);
 int  t1_hinter__set_font42_data(t1_hinter * this, int FontType, gs_type42_data *pdata,
                         bool no_grid_fitting);
 
@@ -101,6 +101,12 @@ typedef struct gx_device_halftone_s gx_device_halftone;
 typedef struct gs_color_space_s gs_color_space;
 #endif
 
+/* Opaque type for the clip path intersection cache (see gxcpcache.h). */
+#ifndef gx_clip_cache_DEFINED
+#  define gx_clip_cache_DEFINED
+typedef struct gx_clip_cache_s gx_clip_cache;
+#endif
+
 /*
  * We need some special memory management for the components of a
  * c.r. state, as indicated by the following notations on the elements:
@@ -270,12 +276,13 @@ typedef struct gs_xstate_trans_flags {
         gsicc_manager_t *icc_manager; /* ICC color manager, profile */\
         gsicc_link_cache_t *icc_link_cache; /* ICC linked transforms */\
         gsicc_profile_cache_t *icc_profile_cache;  /* ICC profiles from PS. */\
+        gx_clip_cache *clip_cache; /* (RC) recent clip path intersections */\
         CUSTOM_COLOR_PTR	/* Pointer to custom color callback struct */\
         const gx_color_map_procs *\
           (*get_cmap_procs)(const gs_imager_state *, const gx_device *);\
         gs_color_rendering_state_common
 #define st_imager_state_num_ptrs\
-  (st_line_params_num_ptrs + st_cr_state_num_ptrs + 6)
+  (st_line_params_num_ptrs + st_cr_state_num_ptrs + 7)
 /* Access macros */
 #define ctm_only(pis) (*(const gs_matrix *)&(pis)->ctm)
 #define ctm_only_writable(pis) (*(gs_matrix *)&(pis)->ctm)
@@ -303,7 +310,7 @@ struct gs_imager_state_s {
   lop_default, gx_max_color_value, BLEND_MODE_Compatible,\
 { 1.0 }, { 1.0 }, {0, 0}, 0, 0/*false*/, 0, 0, 0, 0, 0/*false*/, 0, 0, 0/*false*/, 0, 0, 1.0,  \
    { fixed_half, fixed_half }, 0/*false*/, 0/*false*/, 0/*false*/, 1.0,\
-  1, 0, 0, 0, INIT_CUSTOM_COLOR_PTR	/* 'Custom color' callback pointer */  \
+  1, 0, 0, 0, 0, INIT_CUSTOM_COLOR_PTR	/* 'Custom color' callback pointer */  \
   gx_default_get_cmap_procs
 
 /* The imager state structure is public only for subclassing. */
@@ -49,13 +49,8 @@ static void gx_print_segment(const segment *);
 
 /* Structure descriptors for paths and path segment types. */
 public_st_path();
+static struct_proc_finalize(path_segments_finalize);
 private_st_path_segments();
-private_st_segment();
-private_st_line();
-private_st_dash();
-private_st_line_close();
-private_st_curve();
-private_st_subpath();
 
 /* ------ Initialize/free paths ------ */
 
@@ -106,6 +101,7 @@ gx_path_init_contents(gx_path * ppath)
 {
     ppath->box_last = 0;
     ppath->first_subpath = ppath->current_subpath = 0;
+    ppath->segments->contents.blocks = 0;
     ppath->subpath_count = 0;
     ppath->curve_count = 0;
     path_update_newpath(ppath);
@@ -130,6 +126,7 @@ path_alloc_segments(gx_path_segments ** ppsegs, gs_memory_t * mem,
     rc_alloc_struct_1(*ppsegs, gx_path_segments, &st_path_segments,
                       mem, return_error(gs_error_VMerror), cname);
     (*ppsegs)->rc.free = rc_free_path_segments;
+    (*ppsegs)->contents.blocks = 0;
     return 0;
 }
 int
@@ -234,6 +231,7 @@ gx_path_init_bbox_accumulator(gx_path * ppath)
     ppath->curve_count = 0;
     ppath->local_segments.contents.subpath_first = 0;
     ppath->local_segments.contents.subpath_current = 0;
+    ppath->local_segments.contents.blocks = 0;
     ppath->segments = 0;
     path_update_newpath(ppath);
     ppath->bbox.p.x = ppath->bbox.q.x = 0;
@@ -362,28 +360,30 @@ gx_path_assign_free(gx_path * ppto, gx_path * ppfrom)
 
 /*
  * Free the segments of a path when their reference count goes to zero.
- * We do this in reverse order so as to maximize LIFO allocator behavior.
- * We don't have to worry about cleaning up pointers, because we're about
- * to free the segments object.
+ * Since the segments are allocated in blocks, we only have to free
+ * the blocks.
  */
 static void
+path_free_segment_blocks(gx_path_segments * psegs, client_name_t cname)
+{
+    gx_path_segment_block *pblock = psegs->contents.blocks;
+
+    while (pblock) {
+        gx_path_segment_block *next = pblock->next;
+
+        gs_free_object(pblock->memory, pblock, cname);
+        pblock = next;
+    }
+    psegs->contents.blocks = 0;
+}
+static void
 rc_free_path_segments_local(gs_memory_t * mem, void *vpsegs,
                             client_name_t cname)
 {
     gx_path_segments *psegs = (gx_path_segments *) vpsegs;
-    segment *pseg;
 
-    mem = gs_memory_stable(mem);
-    if (psegs->contents.subpath_first == 0)
-        return;			/* empty path */
-    pseg = (segment *) psegs->contents.subpath_current->last;
-    while (pseg) {
-        segment *prev = pseg->prev;
-
-        trace_segment("[P]release", pseg);
-        gs_free_object(mem, pseg, cname);
-        pseg = prev;
-    }
+    path_free_segment_blocks(psegs, cname);
+    psegs->contents.subpath_first = psegs->contents.subpath_current = 0;
 }
 static void
 rc_free_path_segments(gs_memory_t * mem, void *vpsegs, client_name_t cname)
@@ -392,6 +392,87 @@ rc_free_path_segments(gs_memory_t * mem, void *vpsegs, client_name_t cname)
     gs_free_object(mem, vpsegs, cname);
 }
 
+/* The GC or a restore may free a segments object without releasing it. */
+static void
+path_segments_finalize(const gs_memory_t *cmem, void *vptr)
+{
+    path_free_segment_blocks((gx_path_segments *) vptr,
+                             "path_segments_finalize");
+}
+
+/* ------ Segment storage ------ */
+
+/*
+ * Blocks grow geometrically, so that small paths (glyphs, rectangles,
+ * stroke pieces) take a single small allocation while big ones need
+ * only a few large ones.
+ */
+#define path_block_size_min 512
+#define path_block_size_max 65536
+#define path_segment_round(size) ROUND_UP(size, ARCH_ALIGN_MEMORY_MOD)
+#define path_block_header_size path_segment_round(sizeof(gx_path_segment_block))
+#define path_block_data(pblock) ((byte *)(pblock) + path_block_header_size)
+
+static void *
+path_segment_storage(gx_path * ppath, uint size, client_name_t cname)
+{
+    gx_path_segments *psegs = ppath->segments;
+    gx_path_segment_block *pblock = psegs->contents.blocks;
+    byte *data;
+
+    size = path_segment_round(size);
+    if (pblock == 0 || pblock->size - pblock->used < size) {
+        gs_memory_t *mem = gs_memory_stable(ppath->memory)->non_gc_memory;
+        uint bsize = (pblock == 0 ? path_block_size_min :
+                      min(pblock->size * 2, path_block_size_max));
+        gx_path_segment_block *pnew = (gx_path_segment_block *)
+            gs_alloc_bytes(mem, path_block_header_size + bsize, cname);
+
+        if (pnew == 0)
+            return 0;
+        pnew->next = pblock;
+        pnew->memory = mem;
+        pnew->size = bsize;
+        pnew->used = 0;
+        psegs->contents.blocks = pblock = pnew;
+    }
+    data = path_block_data(pblock) + pblock->used;
+    pblock->used += size;
+    return data;
+}
+
+static uint
+path_segment_size(const segment * pseg)
+{
+    switch (pseg->type) {
+        case s_start:
+            return sizeof(subpath);
+        case s_line_close:
+            return sizeof(line_close_segment);
+        case s_curve:
+            return sizeof(curve_segment);
+        case s_dash:
+            return sizeof(dash_segment);
+        default:
+            return sizeof(line_segment);
+    }
+}
+
+void
+gx_path_release_segment(gx_path * ppath, segment * pseg)
+{
+    gx_path_segment_block *pblock = ppath->segments->contents.blocks;
+    uint size;
+
+    if (pseg == 0)
+        return;
+    size = path_segment_round(path_segment_size(pseg));
+    trace_segment("[P]release", pseg);
+    if (pblock != 0 && pblock->used >= size &&
+        (byte *)pseg == path_block_data(pblock) + pblock->used - size)
+        pblock->used -= size;
+}
+
 /* ------ Incremental path building ------ */
 
 /* Guarantee that a path's segments are not shared with any other path. */
@@ -420,11 +501,10 @@ rc_free_path_segments(gs_memory_t * mem, void *vpsegs, client_name_t cname)
 /* Note that they assume that ppath points to the path. */
 /* We have to split the macro into two because of limitations */
 /* on the size of a single statement (sigh). */
-#define path_alloc_segment(pseg,ctype,pstype,stype,snotes,cname)\
+#define path_alloc_segment(pseg,ctype,stype,snotes,cname)\
   path_unshare(ppath);\
   psub = ppath->current_subpath;\
-  if( !(pseg = gs_alloc_struct(gs_memory_stable(ppath->memory), ctype,\
-                               pstype, cname)) )\
+  if( !(pseg = (ctype *)path_segment_storage(ppath, sizeof(ctype), cname)) )\
     return_error(gs_error_VMerror);\
   pseg->type = stype, pseg->notes = snotes, pseg->next = 0
 #define path_alloc_link(pseg)\
@@ -462,7 +542,7 @@ gx_path_new_subpath(gx_path * ppath)
     subpath *psub;
     subpath *spp;
 
-    path_alloc_segment(spp, subpath, &st_subpath, s_start, sn_none,
+    path_alloc_segment(spp, subpath, s_start, sn_none,
                        "gx_path_new_subpath");
     spp->last = (segment *) spp;
     spp->curve_count = 0;
@@ -579,7 +659,7 @@ gz_path_add_line_notes(gx_path * ppath, fixed x, fixed y, segment_notes notes)
     if (ppath->bbox_set)
         check_in_bbox(ppath, x, y);
     path_open();
-    path_alloc_segment(lp, line_segment, &st_line, s_line, notes,
+    path_alloc_segment(lp, line_segment, s_line, notes,
                        "gx_path_add_line");
     path_alloc_link(lp);
     path_set_point(lp, x, y);
@@ -609,7 +689,7 @@ gz_path_add_gap_notes(gx_path * ppath, fixed x, fixed y, segment_notes notes)
     if (ppath->bbox_set)
         check_in_bbox(ppath, x, y);
     path_open();
-    path_alloc_segment(lp, line_segment, &st_line, s_gap, notes,
+    path_alloc_segment(lp, line_segment, s_gap, notes,
                        "gx_path_add_gap");
     path_alloc_link(lp);
     path_set_point(lp, x, y);
@@ -658,9 +738,9 @@ gx_path_add_lines_notes(gx_path *ppath, const gs_fixed_point *ppts, int count,
             code = gs_note_error(gs_error_rangecheck);
             break;
         }
-        if (!(next = gs_alloc_struct(gs_memory_stable(ppath->memory),
-                                     line_segment, &st_line,
-                                     "gx_path_add_lines"))
+        if (!(next = (line_segment *)
+              path_segment_storage(ppath, sizeof(line_segment),
+                                   "gx_path_add_lines"))
             ) {
             code = gs_note_error(gs_error_VMerror);
             break;
@@ -695,7 +775,7 @@ gx_path_add_dash_notes(gx_path * ppath, fixed x, fixed y, fixed dx, fixed dy, se
     if (ppath->bbox_set)
         check_in_bbox(ppath, x, y);
     path_open();
-    path_alloc_segment(lp, dash_segment, &st_dash, s_dash, notes,
+    path_alloc_segment(lp, dash_segment, s_dash, notes,
                        "gx_dash_add_dash");
     path_alloc_link(lp);
     path_set_point(lp, x, y);
@@ -748,7 +828,7 @@ gz_path_add_curve_notes(gx_path * ppath,
         check_in_bbox(ppath, x3, y3);
     }
     path_open();
-    path_alloc_segment(lp, curve_segment, &st_curve, s_curve, notes,
+    path_alloc_segment(lp, curve_segment, s_curve, notes,
                        "gx_path_add_curve");
     path_alloc_link(lp);
     lp->p1.x = x1;
@@ -812,6 +892,29 @@ fixed x3, fixed y3, fixed xt, fixed yt, floatp fraction, segment_notes notes)
                                    x3, y3, notes | sn_from_arc);
 }
 
+/*
+ * Give the segment blocks of one segments object to another.  The
+ * receiving object keeps allocating from its own newest block.
+ */
+static void
+path_transfer_blocks(gx_path_segments * ptosegs, gx_path_segments * pfromsegs)
+{
+    gx_path_segment_block *pfirst = pfromsegs->contents.blocks;
+    gx_path_segment_block *plast = pfirst;
+
+    if (pfirst == 0)
+        return;
+    while (plast->next)
+        plast = plast->next;
+    if (ptosegs->contents.blocks == 0)
+        ptosegs->contents.blocks = pfirst;
+    else {
+        plast->next = ptosegs->contents.blocks->next;
+        ptosegs->contents.blocks->next = pfirst;
+    }
+    pfromsegs->contents.blocks = 0;
+}
+
 /* Append a path to another path, and reset the first path. */
 /* Currently this is only used to append a path to its parent */
 /* (the path in the previous graphics context). */
@@ -835,6 +938,7 @@ gx_path_add_path(gx_path * ppath, gx_path * ppfrom)
         ppath->curve_count += ppfrom->curve_count;
     }
     /* Transfer the remaining state. */
+    path_transfer_blocks(ppath->segments, ppfrom->segments);
     ppath->position = ppfrom->position;
     ppath->state_flags = ppfrom->state_flags;
     /* Reset the source path. */
@@ -906,7 +1010,7 @@ gz_path_close_subpath_notes(gx_path * ppath, segment_notes notes)
         if (code < 0)
             return code;
     }
-    path_alloc_segment(lp, line_close_segment, &st_line_close,
+    path_alloc_segment(lp, line_close_segment,
                        s_line_close, notes, "gx_path_close_subpath");
     path_alloc_link(lp);
     path_set_point(lp, psub->pt.x, psub->pt.y);
@@ -965,7 +1069,7 @@ gx_path_pop_close_notes(gx_path * ppath, segment_notes notes)
     prev = pseg->prev;
     prev->next = 0;
     psub->last = prev;
-    gs_free_object(ppath->memory, pseg, "gx_path_pop_close_subpath");
+    gx_path_release_segment(ppath, pseg);
     return gx_path_close_subpath_notes(ppath, notes);
 }
 
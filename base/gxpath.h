@@ -265,6 +265,24 @@ int gx_path_add_dash_expansion(const gx_path * /*old*/, gx_path * /*new*/,
 void gx_point_scale_exp2(gs_fixed_point *, int, int),
       gx_rect_scale_exp2(gs_fixed_rect *, int, int);
 
+/*
+ * Dash expansion can deliver its pieces to a receiver instead of
+ * building a path, so that a client which only draws the pieces need
+ * not store them.  gx_path_add_dash_expansion uses a receiver that
+ * appends to the new path.  The old path must contain no curves.
+ */
+typedef struct gx_dash_receiver_s gx_dash_receiver;
+struct gx_dash_receiver_s {
+    int (*add_point)(gx_dash_receiver *, fixed, fixed);
+    int (*add_line)(gx_dash_receiver *, fixed, fixed, segment_notes);
+    int (*add_dash)(gx_dash_receiver *, fixed, fixed, fixed, fixed,
+                    segment_notes);
+    int (*close_subpath)(gx_dash_receiver *, segment_notes);
+};
+int gx_path_enum_dash_expansion(const gx_path * /*old*/,
+                                const gs_imager_state *,
+                                gx_dash_receiver *);
+
 /* Path enumerator */
 
 /* This interface does not make a copy of the path. */
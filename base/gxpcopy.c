@@ -809,11 +809,11 @@ gx_path_merge_contacting_contours(gx_path *ppath)
                     /* Change 'closepath' of the subpath 1 to a line (maybe degenerate) : */
                     sp1last->type = s_line;
                     /* sp1 is not longer in use. Free it : */
-                    gs_free_object(gs_memory_stable(ppath->memory), sp1, "gx_path_merge_contacting_contours");
+                    gx_path_release_segment(ppath, (segment *)sp1);
                 } else if (sp1last->pt.x == sp1->pt.x && sp1last->pt.y == sp1->pt.y) {
                     /* Implicit closepath with zero length. Don't need a new segment. */
                     /* sp1 is not longer in use. Free it : */
-                    gs_free_object(gs_memory_stable(ppath->memory), sp1, "gx_path_merge_contacting_contours");
+                    gx_path_release_segment(ppath, (segment *)sp1);
                 } else {
                     /* Insert the closing line segment. */
                     /* sp1 is not longer in use. Convert it to the line segment : */
@@ -837,7 +837,7 @@ gx_path_merge_contacting_contours(gx_path *ppath)
                     if (ppath->segments->contents.subpath_current == sp1) {
                         ppath->segments->contents.subpath_current = sp1p;
                     }
-                    gs_free_object(gs_memory_stable(ppath->memory), sp1, "gx_path_merge_contacting_contours");
+                    gx_path_release_segment(ppath, (segment *)sp1);
                     sp1 = 0; /* Safety. */
                 }
                 /* Insert the subpath 1 into the subpath 0 before sc0 :*/
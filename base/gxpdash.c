@@ -28,28 +28,76 @@
 
 /* Expand a dashed path into explicit segments. */
 /* The path contains no curves. */
-static int subpath_expand_dashes(const subpath *, gx_path *,
+static int subpath_expand_dashes(const subpath *, gx_dash_receiver *,
                                   const gs_imager_state *,
                                   const gx_dash_params *);
+
+/* Enumerate the dashes of a path, passing them to a receiver. */
 int
-gx_path_add_dash_expansion(const gx_path * ppath_old, gx_path * ppath,
-                           const gs_imager_state * pis)
+gx_path_enum_dash_expansion(const gx_path * ppath_old,
+                            const gs_imager_state * pis,
+                            gx_dash_receiver * prcv)
 {
     const subpath *psub;
     const gx_dash_params *dash = &gs_currentlineparams(pis)->dash;
     int code = 0;
 
-    if (dash->pattern_size == 0)
-        return gx_path_copy(ppath_old, ppath);
     for (psub = ppath_old->first_subpath; psub != 0 && code >= 0;
          psub = (const subpath *)psub->last->next
         )
-        code = subpath_expand_dashes(psub, ppath, pis, dash);
+        code = subpath_expand_dashes(psub, prcv, pis, dash);
     return code;
 }
 
+/* A receiver that builds a path. */
+typedef struct dash_path_receiver_s {
+    gx_dash_receiver common;
+    gx_path *ppath;
+} dash_path_receiver;
+
+static int
+dpr_add_point(gx_dash_receiver * prcv, fixed x, fixed y)
+{
+    return gx_path_add_point(((dash_path_receiver *)prcv)->ppath, x, y);
+}
+static int
+dpr_add_line(gx_dash_receiver * prcv, fixed x, fixed y, segment_notes notes)
+{
+    return gx_path_add_line_notes(((dash_path_receiver *)prcv)->ppath,
+                                  x, y, notes);
+}
+static int
+dpr_add_dash(gx_dash_receiver * prcv, fixed x, fixed y, fixed dx, fixed dy,
+             segment_notes notes)
+{
+    return gx_path_add_dash_notes(((dash_path_receiver *)prcv)->ppath,
+                                  x, y, dx, dy, notes);
+}
+static int
+dpr_close_subpath(gx_dash_receiver * prcv, segment_notes notes)
+{
+    return gx_path_close_subpath_notes(((dash_path_receiver *)prcv)->ppath,
+                                       notes);
+}
+
+int
+gx_path_add_dash_expansion(const gx_path * ppath_old, gx_path * ppath,
+                           const gs_imager_state * pis)
+{
+    dash_path_receiver rcv;
+
+    if (gs_currentlineparams(pis)->dash.pattern_size == 0)
+        return gx_path_copy(ppath_old, ppath);
+    rcv.common.add_point = dpr_add_point;
+    rcv.common.add_line = dpr_add_line;
+    rcv.common.add_dash = dpr_add_dash;
+    rcv.common.close_subpath = dpr_close_subpath;
+    rcv.ppath = ppath;
+    return gx_path_enum_dash_expansion(ppath_old, pis, &rcv.common);
+}
+
 static int
-subpath_expand_dashes(const subpath * psub, gx_path * ppath,
+subpath_expand_dashes(const subpath * psub, gx_dash_receiver * prcv,
                    const gs_imager_state * pis, const gx_dash_params * dash)
 {
     const float *pattern = dash->pattern;
@@ -78,7 +126,7 @@ subpath_expand_dashes(const subpath * psub, gx_path * ppath,
         start_notes = 0;
     }
 
-    if ((code = gx_path_add_point(ppath, x0, y0)) < 0)
+    if ((code = prcv->add_point(prcv, x0, y0)) < 0)
         return code;
     /*
      * To do the right thing at the beginning of a closed path, we have
@@ -142,21 +190,21 @@ subpath_expand_dashes(const subpath * psub, gx_path * ppath,
             if (ink_on && !gap) {
                 if (drawing >= 0) {
                     if (left >= elt_length && any_abs(fx) + any_abs(fy) < fixed_half)
-                        code = gx_path_add_dash_notes(ppath, nx, ny, udx, udy,
-                                                      ((notes & pseg->notes)|
-                                                       start_notes|
-                                                       sn_dash_tail));
+                        code = prcv->add_dash(prcv, nx, ny, udx, udy,
+                                              ((notes & pseg->notes)|
+                                               start_notes|
+                                               sn_dash_tail));
                     else
-                        code = gx_path_add_line_notes(ppath, nx, ny,
-                                                      ((notes & pseg->notes)|
-                                                       start_notes|
-                                                       sn_dash_tail));
+                        code = prcv->add_line(prcv, nx, ny,
+                                              ((notes & pseg->notes)|
+                                               start_notes|
+                                               sn_dash_tail));
                 }
                 notes |= sn_not_first;
             } else {
                 if (drawing > 0)	/* done */
                     return 0;
-                code = gx_path_add_point(ppath, nx, ny);
+                code = prcv->add_point(prcv, nx, ny);
                 notes &= ~sn_not_first;
                 drawing = 0;
             }
@@ -195,10 +243,10 @@ subpath_expand_dashes(const subpath * psub, gx_path * ppath,
       on:if (ink_on && !gap) {
             if (drawing >= 0) {
                 if (pseg->type == s_line_close && drawing > 0)
-                    code = gx_path_close_subpath_notes(ppath,
-                                                       ((notes & pseg->notes)|
-                                                        start_notes |
-                                                        end_notes));
+                    code = prcv->close_subpath(prcv,
+                                               ((notes & pseg->notes)|
+                                                start_notes |
+                                                end_notes));
                 else if ((any_abs(sx - x) + any_abs(sy - y) < fixed_half) &&
                          (udx | udy))
                     /* If we only need to move a short distance, then output
@@ -206,17 +254,17 @@ subpath_expand_dashes(const subpath * psub, gx_path * ppath,
                      * accurate. There is no point in outputting such dash
                      * notes if we don't have any useful information to put
                      * in the note though (if udx == 0 && udy == 0). */
-                    code = gx_path_add_dash_notes(ppath, sx, sy, udx, udy,
-                                                  ((notes & pseg->notes)|
-                                                   start_notes | end_notes));
+                    code = prcv->add_dash(prcv, sx, sy, udx, udy,
+                                          ((notes & pseg->notes)|
+                                           start_notes | end_notes));
                 else
-                    code = gx_path_add_line_notes(ppath, sx, sy,
-                                                  ((notes & pseg->notes)|
-                                                   start_notes | end_notes));
+                    code = prcv->add_line(prcv, sx, sy,
+                                          ((notes & pseg->notes)|
+                                           start_notes | end_notes));
                 notes |= sn_not_first;
             }
         } else {
-            code = gx_path_add_point(ppath, sx, sy);
+            code = prcv->add_point(prcv, sx, sy);
             notes &= ~sn_not_first;
             if (elt_length < fixed2float(fixed_epsilon) &&
                 (pseg->next == 0 ||
@@ -250,9 +298,9 @@ subpath_expand_dashes(const subpath * psub, gx_path * ppath,
                    (at its end). */
                 if (elt_length1 == 0) {
                     left = 0;
-                    code = gx_path_add_dash_notes(ppath, sx, sy, udx, udy,
-                                                  ((notes & pseg->notes)|
-                                                  start_notes | end_notes));
+                    code = prcv->add_dash(prcv, sx, sy, udx, udy,
+                                          ((notes & pseg->notes)|
+                                          start_notes | end_notes));
                     if (++index == count)
                         index = 0;
                     elt_length = pattern[index] * scale;
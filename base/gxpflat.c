@@ -452,6 +452,85 @@ last:
     return false;
 }
 
+/*
+ * Generate the end points of up to max_count successive segments into
+ * points[], and store their number to *pcount.  The iterator is left in
+ * the same state as after as many calls to gx_flattened_iterator__next,
+ * which this returns the last result of.  The state is kept in local
+ * variables for the whole run, and the x and y accumulations are
+ * independent and branch-free, so a long curve costs a few operations
+ * per point instead of a call with memory traffic.
+ */
+int
+gx_flattened_iterator__next_points(gx_flattened_iterator *self,
+            gs_fixed_point *points, int max_count, int *pcount)
+{
+    fixed x, y, px, py;
+    fixed idx, idy, id2x, id2y;
+    uint rx, ry, rdx, rdy, rd2x, rd2y;
+    const fixed id3x = self->id3x, id3y = self->id3y;
+    const uint rd3x = self->rd3x, rd3y = self->rd3y;
+    const uint rmask = self->rmask;
+    uint i = self->i;
+    int n = 0;
+
+    if (i <= 0 || max_count <= 0)
+        return_error(gs_error_unregistered); /* Must not happen. */
+    if (self->k <= 1) {
+        /* At most 2 segments, not worth setting up. */
+        int code;
+
+        do {
+            code = gx_flattened_iterator__next(self);
+            if (code < 0)
+                return code;
+            points[n].x = self->lx1;
+            points[n].y = self->ly1;
+            n++;
+        } while (code && n < max_count);
+        *pcount = n;
+        return code;
+    }
+    x = px = self->lx1, y = py = self->ly1;
+    rx = self->rx, ry = self->ry;
+    idx = self->idx, idy = self->idy;
+    rdx = self->rdx, rdy = self->rdy;
+    id2x = self->id2x, id2y = self->id2y;
+    rd2x = self->rd2x, rd2y = self->rd2y;
+#   define accum(i, r, di, dr)\
+        r += dr, i += di + (r > rmask), r &= rmask
+    while (n < max_count) {
+        px = x, py = y;
+        if (--i == 0) {
+            x = self->x3, y = self->y3;
+            points[n].x = x, points[n].y = y;
+            n++;
+            break;
+        }
+        accum(x, rx, idx, rdx);
+        accum(y, ry, idy, rdy);
+        accum(idx, rdx, id2x, rd2x);
+        accum(idy, rdy, id2y, rd2y);
+        accum(id2x, rd2x, id3x, rd3x);
+        accum(id2y, rd2y, id3y, rd3y);
+        points[n].x = x, points[n].y = y;
+        n++;
+    }
+#   undef accum
+    self->i = i;
+    self->lx0 = px, self->ly0 = py;
+    self->lx1 = x, self->ly1 = y;
+    /* The last segment doesn't advance the accumulator. */
+    self->x = (i ? x : px), self->y = (i ? y : py);
+    self->rx = rx, self->ry = ry;
+    self->idx = idx, self->idy = idy;
+    self->rdx = rdx, self->rdy = rdy;
+    self->id2x = id2x, self->id2y = id2y;
+    self->rd2x = rd2x, self->rd2y = rd2y;
+    *pcount = n;
+    return i != 0;
+}
+
 static inline void
 gx_flattened_iterator__unaccum(gx_flattened_iterator *self)
 {
@@ -577,24 +656,21 @@ top :
                         pc->pt.x, pc->pt.y, notes);
     } else {
         gs_fixed_point *ppt = points;
-        bool more;
+        int n;
 
         for(;;) {
-            code = gx_flattened_iterator__next(self);
-
+            code = gx_flattened_iterator__next_points(self, ppt,
+                                        &points[max_points] - ppt, &n);
             if (code < 0)
                 return code;
-            more = code;
-            ppt->x = self->lx1;
-            ppt->y = self->ly1;
-            ppt++;
-            if (ppt == &points[max_points] || !more) {
-                gs_fixed_point *pe = (more ?  ppt - 2 : ppt);
+            ppt += n;
+            if (ppt == &points[max_points] || !code) {
+                gs_fixed_point *pe = (code ?  ppt - 2 : ppt);
 
                 code = generate_segments(ppath, points, pe - points, notes);
                 if (code < 0)
                     return code;
-                if (!more)
+                if (pe == ppt)
                     return 0;
                 notes |= sn_not_first;
                 memcpy(points, pe, (char *)ppt - (char *)pe);
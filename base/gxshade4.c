@@ -69,7 +69,7 @@ Gt_next_vertex(const gs_shading_mesh_t * psh, shade_coord_stream_t * cs,
     return code;
 }
 
-static inline int
+static int
 Gt_fill_triangle(patch_fill_state_t * pfs, const shading_vertex_t * va,
                  const shading_vertex_t * vb, const shading_vertex_t * vc)
 {
@@ -87,6 +87,16 @@ Gt_fill_triangle(patch_fill_state_t * pfs, const shading_vertex_t * va,
     return code;
 }
 
+static inline int
+Gt_fill_triangle_strips(patch_fill_state_t * pfs, patch_fill_strips_t *strips,
+                        const shading_vertex_t * va, const shading_vertex_t * vb,
+                        const shading_vertex_t * vc)
+{
+    if (strips != NULL)
+        return patch_fill_strips_triangle(strips, va, vb, vc);
+    return Gt_fill_triangle(pfs, va, vb, vc);
+}
+
 int
 gs_shading_FfGt_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
                                const gs_fixed_rect * rect_clip,
@@ -94,6 +104,7 @@ gs_shading_FfGt_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
 {
     const gs_shading_FfGt_t * const psh = (const gs_shading_FfGt_t *)psh0;
     patch_fill_state_t pfs;
+    patch_fill_strips_t *strips;
     const gs_shading_mesh_t *pshm = (const gs_shading_mesh_t *)psh;
     shade_coord_stream_t cs;
     int num_bits = psh->params.BitsPerFlag;
@@ -120,6 +131,12 @@ gs_shading_FfGt_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
         if (pfs.icclink != NULL) gsicc_release_link(pfs.icclink);
         return code;
     }
+    code = patch_fill_strips_begin(&pfs, Gt_fill_triangle, &strips);
+    if (code < 0) {
+        term_patch_fill_state(&pfs);
+        if (pfs.icclink != NULL) gsicc_release_link(pfs.icclink);
+        return code;
+    }
     reserve_colors(&pfs, C, 3); /* Can't fail */
     va.c = ca = C[0];
     vb.c = cb = C[1];
@@ -130,6 +147,8 @@ gs_shading_FfGt_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
     while ((flag = shade_next_flag(&cs, num_bits)) >= 0) {
         switch (flag) {
             default:
+                if (strips != NULL)
+                    patch_fill_strips_end(strips, gs_error_rangecheck);
                 return_error(gs_error_rangecheck);
             case 0:
                 if ((code = Gt_next_vertex(pshm, &cs, &va, ca)) < 0 ||
@@ -151,11 +170,13 @@ gs_shading_FfGt_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
                 vc.c = cc = c;
 v2:		if ((code = Gt_next_vertex(pshm, &cs, &vc, cc)) < 0)
                     break;
-                if ((code = Gt_fill_triangle(&pfs, &va, &vb, &vc)) < 0)
+                if ((code = Gt_fill_triangle_strips(&pfs, strips, &va, &vb, &vc)) < 0)
                     break;
         }
         cs.align(&cs, 8); /* Debugged with 12-14O.PS page 2. */
     }
+    if (strips != NULL)
+        code = patch_fill_strips_end(strips, code);
     if (VD_TRACE_TRIANGLE_PATCH && vd_allowed('s'))
         vd_release_dc;
     release_colors(&pfs, pfs.color_stack, 3);
@@ -174,6 +195,7 @@ gs_shading_LfGt_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
 {
     const gs_shading_LfGt_t * const psh = (const gs_shading_LfGt_t *)psh0;
     patch_fill_state_t pfs;
+    patch_fill_strips_t *strips = NULL;
     const gs_shading_mesh_t *pshm = (const gs_shading_mesh_t *)psh;
     shade_coord_stream_t cs;
     shading_vertex_t *vertex = NULL;
@@ -197,6 +219,9 @@ gs_shading_LfGt_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
     pfs.Function = pshm->params.Function;
     pfs.rect = *rect_clip;
     code = init_patch_fill_state(&pfs);
+    if (code < 0)
+        goto out;
+    code = patch_fill_strips_begin(&pfs, Gt_fill_triangle, &strips);
     if (code < 0)
         goto out;
     reserve_colors(&pfs, &cn, 1); /* Can't fail. */
@@ -233,7 +258,7 @@ gs_shading_LfGt_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
         if (code < 0)
             goto out;
         for (i = 1; i < per_row; ++i) {
-            code = Gt_fill_triangle(&pfs, &vertex[i - 1], &vertex[i], &next);
+            code = Gt_fill_triangle_strips(&pfs, strips, &vertex[i - 1], &vertex[i], &next);
             if (code < 0)
                 goto out;
             c = color_buffer_ptrs[i - 1];
@@ -243,7 +268,7 @@ gs_shading_LfGt_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
             code = Gt_next_vertex(pshm, &cs, &next, cn);
             if (code < 0)
                 goto out;
-            code = Gt_fill_triangle(&pfs, &vertex[i], &vertex[i - 1], &next);
+            code = Gt_fill_triangle_strips(&pfs, strips, &vertex[i], &vertex[i - 1], &next);
             if (code < 0)
                 goto out;
         }
@@ -253,6 +278,8 @@ gs_shading_LfGt_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
         next.c = cn = c;
     }
 out:
+    if (strips != NULL)
+        code = patch_fill_strips_end(strips, code);
     if (VD_TRACE_TRIANGLE_PATCH && vd_allowed('s'))
         vd_release_dc;
     gs_free_object(pis->memory, vertex, "gs_shading_LfGt_render");
@@ -152,6 +152,10 @@ struct patch_fill_state_s {
     byte *color_stack_limit;
     gs_memory_t *memory; /* Where color_buffer is allocated. */
     gs_color_index_cache_t *pcic;
+    /* When filling in strips, threads share color conversion and
+       maybe Function evaluation; these serialize them, or are NULL. */
+    struct gx_monitor_s *color_lock;
+    struct gx_monitor_s *function_lock;
 } ;
 
 /* Define a structure for mesh or patch vertex. */
@@ -211,4 +215,24 @@ void release_colors(patch_fill_state_t *pfs, byte *ptr, int n);
 
 dev_proc_fill_linear_color_triangle(gx_fill_triangle_small);
 
+/*
+ * Big meshes and patch sets on memory devices may be filled by several
+ * threads, each painting one horizontal strip of the clipping rectangle
+ * with its own fill state.  The caller decodes triangles or patches as
+ * usual and passes them here; they are filled in batches.
+ * patch_fill_strips_begin sets *ppfst to NULL when this can't be done,
+ * and the caller must fill by itself.
+ */
+typedef struct patch_fill_strips_s patch_fill_strips_t;
+typedef int (*patch_fill_triangle_proc_t)(patch_fill_state_t *pfs,
+    const shading_vertex_t *p0, const shading_vertex_t *p1, const shading_vertex_t *p2);
+
+int patch_fill_strips_begin(patch_fill_state_t *pfs,
+        patch_fill_triangle_proc_t fill_triangle, patch_fill_strips_t **ppfst);
+int patch_fill_strips_triangle(patch_fill_strips_t *pfst,
+        const shading_vertex_t *p0, const shading_vertex_t *p1, const shading_vertex_t *p2);
+int patch_fill_strips_patch(patch_fill_strips_t *pfst, const patch_curve_t curve[4],
+        const gs_fixed_point interior[4]);
+int patch_fill_strips_end(patch_fill_strips_t *pfst, int code);
+
 #endif /* gxshade4_INCLUDED */
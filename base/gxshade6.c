@@ -38,6 +38,15 @@
 #include "vdtrace.h"
 #include "gsicc_cache.h"
 #include "gxdevsop.h"
+#include "gxdevmem.h"
+#include "gxcpath.h"
+#include "gzcpath.h"
+#include "gsdsrc.h"
+#include "gsfunc0.h"
+#include "gsmchunk.h"
+#include "gsstate.h"            /* for gs_currentfillthreads */
+#include "gpsync.h"
+#include "gxsync.h"
 
 #define VD_TRACE_TENSOR_PATCH 1
 
@@ -292,6 +301,8 @@ init_patch_fill_state(patch_fill_state_t *pfs)
     pfs->color_stack = NULL;
     pfs->color_stack_limit = NULL;
     pfs->unlinear = !is_linear_color_applicable(pfs);
+    pfs->color_lock = NULL;
+    pfs->function_lock = NULL;
     return alloc_patch_fill_memory(pfs, pfs->pis->memory, pcs);
 }
 
@@ -316,7 +327,11 @@ patch_resolve_color_inline(patch_color_t * ppcr, const patch_fill_state_t *pfs)
     if (pfs->Function) {
         const gs_color_space *pcs = pfs->direct_space;
 
+        if (pfs->function_lock != NULL)
+            gx_monitor_enter(pfs->function_lock);
         gs_function_evaluate(pfs->Function, ppcr->t, ppcr->cc.paint.values);
+        if (pfs->function_lock != NULL)
+            gx_monitor_leave(pfs->function_lock);
         pcs->type->restrict_color(&ppcr->cc, pcs);
     }
 }
@@ -327,6 +342,30 @@ patch_resolve_color(patch_color_t * ppcr, const patch_fill_state_t *pfs)
     patch_resolve_color_inline(ppcr, pfs);
 }
 
+/* Resolve up to 4 patch colors with one call to the Function. */
+static void
+patch_resolve_colors(patch_color_t **ppcr, int count, const patch_fill_state_t *pfs)
+{
+    if (pfs->Function) {
+        const gs_color_space *pcs = pfs->direct_space;
+        int m = pfs->Function->params.m, n = pfs->Function->params.n, i;
+        float in[4 * countof(ppcr[0]->t)];
+        float out[4 * GS_CLIENT_COLOR_MAX_COMPONENTS];
+
+        for (i = 0; i < count; i++)
+            memcpy(in + i * m, ppcr[i]->t, m * sizeof(float));
+        if (pfs->function_lock != NULL)
+            gx_monitor_enter(pfs->function_lock);
+        gs_function_evaluate_batch(pfs->Function, count, in, out);
+        if (pfs->function_lock != NULL)
+            gx_monitor_leave(pfs->function_lock);
+        for (i = 0; i < count; i++) {
+            memcpy(ppcr[i]->cc.paint.values, out + i * n, n * sizeof(float));
+            pcs->type->restrict_color(&ppcr[i]->cc, pcs);
+        }
+    }
+}
+
 /*
  * Calculate the interpolated color at a given point.
  * Note that we must do this twice for bilinear interpolation.
@@ -441,6 +480,7 @@ gs_shading_Cp_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
 {
     const gs_shading_Cp_t * const psh = (const gs_shading_Cp_t *)psh0;
     patch_fill_state_t state;
+    patch_fill_strips_t *strips;
     shade_coord_stream_t cs;
     patch_curve_t curve[4];
     int code;
@@ -457,6 +497,12 @@ gs_shading_Cp_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
         if (state.icclink != NULL) gsicc_release_link(state.icclink);
         return code;
     }
+    code = patch_fill_strips_begin(&state, NULL, &strips);
+    if (code < 0) {
+        term_patch_fill_state(&state);
+        if (state.icclink != NULL) gsicc_release_link(state.icclink);
+        return code;
+    }
     if (VD_TRACE_TENSOR_PATCH && vd_allowed('s')) {
         vd_get_dc('s');
         vd_set_shift(0, 0);
@@ -469,10 +515,14 @@ gs_shading_Cp_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
     shade_next_init(&cs, (const gs_shading_mesh_params_t *)&psh->params, pis);
     while ((code = shade_next_patch(&cs, psh->params.BitsPerFlag,
                                     curve, NULL)) == 0 &&
-           (code = patch_fill(&state, curve, NULL, Cp_transform)) >= 0
+           (code = (strips != NULL ?
+                    patch_fill_strips_patch(strips, curve, NULL) :
+                    patch_fill(&state, curve, NULL, Cp_transform))) >= 0
         ) {
         DO_NOTHING;
     }
+    if (strips != NULL)
+        code = patch_fill_strips_end(strips, code);
     if (VD_TRACE_TENSOR_PATCH && vd_allowed('s'))
         vd_release_dc;
     if (term_patch_fill_state(&state))
@@ -539,6 +589,7 @@ gs_shading_Tpp_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
 {
     const gs_shading_Tpp_t * const psh = (const gs_shading_Tpp_t *)psh0;
     patch_fill_state_t state;
+    patch_fill_strips_t *strips;
     shade_coord_stream_t cs;
     patch_curve_t curve[4];
     gs_fixed_point interior[4];
@@ -554,6 +605,12 @@ gs_shading_Tpp_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
     code = init_patch_fill_state(&state);
     if(code < 0)
         return code;
+    code = patch_fill_strips_begin(&state, NULL, &strips);
+    if (code < 0) {
+        term_patch_fill_state(&state);
+        if (state.icclink != NULL) gsicc_release_link(state.icclink);
+        return code;
+    }
     if (VD_TRACE_TENSOR_PATCH && vd_allowed('s')) {
         vd_get_dc('s');
         vd_set_shift(0, 0);
@@ -575,10 +632,15 @@ gs_shading_Tpp_fill_rectangle(const gs_shading_t * psh0, const gs_rect * rect,
         swapped_interior[1] = interior[3];
         swapped_interior[2] = interior[2];
         swapped_interior[3] = interior[1];
-        code = patch_fill(&state, curve, swapped_interior, Tpp_transform);
+        if (strips != NULL)
+            code = patch_fill_strips_patch(strips, curve, swapped_interior);
+        else
+            code = patch_fill(&state, curve, swapped_interior, Tpp_transform);
         if (code < 0)
             break;
     }
+    if (strips != NULL)
+        code = patch_fill_strips_end(strips, code);
     if (term_patch_fill_state(&state))
         return_error(gs_error_unregistered); /* Must not happen. */
     if (VD_TRACE_TENSOR_PATCH && vd_allowed('s'))
@@ -1363,8 +1425,8 @@ dc2fc(const patch_fill_state_t *pfs, gx_device_color *pdevc,
 #define DEBUG_COLOR_INDEX_CACHE 0
 
 static inline int
-patch_color_to_device_color_inline(const patch_fill_state_t *pfs, 
-                                   const patch_color_t *c, gx_device_color *pdevc, 
+patch_color_to_device_color_unlocked(const patch_fill_state_t *pfs,
+                                   const patch_color_t *c, gx_device_color *pdevc,
                                    frac31 *frac_values)
 {
     /* Must return 2 if the color is not pure.
@@ -1428,6 +1490,21 @@ patch_color_to_device_color_inline(const patch_fill_state_t *pfs,
     return 0;
 }
 
+static inline int
+patch_color_to_device_color_inline(const patch_fill_state_t *pfs,
+                                   const patch_color_t *c, gx_device_color *pdevc,
+                                   frac31 *frac_values)
+{
+    int code;
+
+    if (pfs->color_lock == NULL)
+        return patch_color_to_device_color_unlocked(pfs, c, pdevc, frac_values);
+    gx_monitor_enter(pfs->color_lock);
+    code = patch_color_to_device_color_unlocked(pfs, c, pdevc, frac_values);
+    gx_monitor_leave(pfs->color_lock);
+    return code;
+}
+
 int
 patch_color_to_device_color(const patch_fill_state_t *pfs, const patch_color_t *c, gx_device_color *pdevc)
 {
@@ -1486,8 +1563,13 @@ isnt_color_monotonic(const patch_fill_state_t *pfs, const patch_color_t *c0, con
        and the result with them may be imprecise.
      */
     uint mask;
-    int code = gs_function_is_monotonic(pfs->Function, c0->t, c1->t, &mask);
+    int code;
 
+    if (pfs->function_lock != NULL)
+        gx_monitor_enter(pfs->function_lock);
+    code = gs_function_is_monotonic(pfs->Function, c0->t, c1->t, &mask);
+    if (pfs->function_lock != NULL)
+        gx_monitor_leave(pfs->function_lock);
     if (code >= 0)
         return mask;
     return code;
@@ -1554,6 +1636,13 @@ function_linearity(const patch_fill_state_t *pfs, const patch_color_t *c0, const
     return s;
 }
 
+static inline bool
+is_color_equal(const patch_fill_state_t *pfs, const patch_color_t *c0, const patch_color_t *c1)
+{
+    return !memcmp(c0->cc.paint.values, c1->cc.paint.values,
+                   sizeof(c0->cc.paint.values[0]) * pfs->num_components);
+}
+
 static inline int
 is_color_linear(const patch_fill_state_t *pfs, const patch_color_t *c0, const patch_color_t *c1)
 {   /* returns : 1 = linear, 0 = unlinear, <0 = error. */
@@ -1566,8 +1655,16 @@ is_color_linear(const patch_fill_state_t *pfs, const patch_color_t *c0, const pa
 
         if (s > pfs->smoothness)
             return 0;
+        /* A constant color is linear in any color space,
+           don't spend color conversions for proving that. */
+        if (is_color_equal(pfs, c0, c1))
+            return 1;
+        if (pfs->color_lock != NULL)
+            gx_monitor_enter(pfs->color_lock);
         code = cs_is_linear(cs, pfs->pis, pfs->dev,
                 &c0->cc, &c1->cc, NULL, NULL, pfs->smoothness - s, pfs->icclink);
+        if (pfs->color_lock != NULL)
+            gx_monitor_leave(pfs->color_lock);
         if (code <= 0)
             return code;
         return 1;
@@ -2140,13 +2237,20 @@ try_device_linear_color(patch_fill_state_t *pfs, bool wedge,
             /* fixme: check an inner color ? */
             s01 = max(s0, s1);
             s012 = max(s01, s2);
-            code = cs_is_linear(cs, pfs->pis, pfs->dev,
-                                &p0->c->cc, &p1->c->cc, &p2->c->cc, NULL,
-                                pfs->smoothness - s012, pfs->icclink);
-            if (code < 0)
-                return code;
-            if (code == 0)
-                return 1;
+            if (!is_color_equal(pfs, p0->c, p1->c) ||
+                !is_color_equal(pfs, p1->c, p2->c)) {
+                if (pfs->color_lock != NULL)
+                    gx_monitor_enter(pfs->color_lock);
+                code = cs_is_linear(cs, pfs->pis, pfs->dev,
+                                    &p0->c->cc, &p1->c->cc, &p2->c->cc, NULL,
+                                    pfs->smoothness - s012, pfs->icclink);
+                if (pfs->color_lock != NULL)
+                    gx_monitor_leave(pfs->color_lock);
+                if (code < 0)
+                    return code;
+                if (code == 0)
+                    return 1;
+            }
         }
     }
     {   gx_device *pdev = pfs->dev;
@@ -3120,6 +3224,8 @@ gx_init_patch_fill_state_for_clist(gx_device *dev, patch_fill_state_t *pfs, gs_m
     pfs->color_stack = NULL; /* fixme */
     pfs->color_stack_limit = NULL; /* fixme */
     pfs->pcic = NULL; /* Will do someday. */
+    pfs->color_lock = NULL;
+    pfs->function_lock = NULL;
     pfs->trans_device = NULL;
     pfs->icclink = NULL;
     return alloc_patch_fill_memory(pfs, memory, NULL);
@@ -4225,10 +4331,7 @@ make_tensor_patch(const patch_fill_state_t *pfs, tensor_patch *p, const patch_cu
     patch_set_color(pfs, p->c[1][0], curve[1].vertex.cc);
     patch_set_color(pfs, p->c[1][1], curve[2].vertex.cc);
     patch_set_color(pfs, p->c[0][1], curve[3].vertex.cc);
-    patch_resolve_color_inline(p->c[0][0], pfs);
-    patch_resolve_color_inline(p->c[0][1], pfs);
-    patch_resolve_color_inline(p->c[1][0], pfs);
-    patch_resolve_color_inline(p->c[1][1], pfs);
+    patch_resolve_colors(&p->c[0][0], 4, pfs);
     if (!pfs->Function) {
         pcs->type->restrict_color(&p->c[0][0]->cc, pcs);
         pcs->type->restrict_color(&p->c[0][1]->cc, pcs);
@@ -4366,3 +4469,350 @@ out:
     release_colors_inline(pfs, color_stack_ptr, 4);
     return code;
 }
+
+/* ---------------- Filling in strips ---------------- */
+
+/*
+ * Each strip fills every triangle or patch of a batch which may touch it,
+ * in order, through a clipping device that passes its scan lines only.
+ * The decomposition doesn't depend on the strip, so the result is exactly
+ * the one of filling by one thread, and strips write disjoint scan lines.
+ * Color conversion goes through the imager state, ICC links and color
+ * caches, which are shared, so it is serialized with a monitor; so is
+ * Function evaluation, when a Function caches samples or reads a stream.
+ * We only do this where drawing itself is safe: pure colors painted into
+ * a chunky memory device, maybe through a clipping device, of which each
+ * strip has its own copy (the copies share the clipping list, but not the
+ * cursor).
+ */
+
+/* Don't bother with strips of fewer rows. */
+#define PATCH_STRIP_MIN_ROWS 64
+/* The number of triangles or patches filled at once. */
+#define PATCH_STRIP_BATCH 128
+/* Allow for paddings and rounding when culling by the strip. */
+#define PATCH_STRIP_MARGIN (fixed_1 * 2)
+
+typedef struct patch_strip_patch_s {
+    patch_curve_t curve[4];
+    gs_fixed_point interior[4];
+    bool tensor;
+} patch_strip_patch_t;
+
+typedef struct patch_strip_s {
+    patch_fill_strips_t *pfst;
+    patch_fill_state_t pfs;
+    fixed ymin, ymax;           /* The strip. */
+    gx_clip_path cpath;         /* The strip, for sdev. */
+    gx_device_clip sdev;        /* Clips to the strip. */
+    gx_device_clip cdev;        /* A copy of the caller's clipping device. */
+    gs_memory_t *memory;
+    gp_thread_id thread;
+    int code;
+} patch_strip_t;
+
+struct patch_fill_strips_s {
+    patch_fill_state_t *pfs;    /* The caller's state. */
+    patch_fill_triangle_proc_t fill_triangle; /* NULL for patches. */
+    gx_monitor_t *lock;
+    int nstrips;
+    patch_strip_t *strips;
+    int count;
+    fixed *bounds;              /* Y bounds, 2 per triangle or patch. */
+    patch_strip_patch_t *patches;
+    shading_vertex_t *vertices; /* 3 per triangle. */
+    byte *colors;               /* Vertex colors, color_stack_step bytes each. */
+};
+
+/*
+ * Check whether evaluating a function must be serialized: Sampled functions
+ * fill in their caches while evaluating (the poles of Order 3 ones, at
+ * least), and a stream has a position.
+ */
+static bool
+function_needs_lock(const gs_function_t *pfn)
+{
+    gs_function_info_t fi;
+    int i;
+
+    if (FunctionType(pfn) == function_type_Sampled)
+        return true;
+    gs_function_get_info(pfn, &fi);
+    if (fi.DataSource != NULL && data_source_is_stream(*fi.DataSource))
+        return true;
+    if (fi.Functions != NULL)
+        for (i = 0; i < fi.num_Functions; i++)
+            if (function_needs_lock(fi.Functions[i]))
+                return true;
+    return false;
+}
+
+static void
+patch_fill_strip(void *arg)
+{
+    patch_strip_t *ps = (patch_strip_t *)arg;
+    const patch_fill_strips_t *pfst = ps->pfst;
+    int i, code = 0;
+
+    for (i = 0; i < pfst->count && code >= 0; i++) {
+        if (pfst->bounds[i * 2 + 1] < ps->ymin ||
+            pfst->bounds[i * 2] > ps->ymax)
+            continue;
+        if (pfst->fill_triangle != NULL) {
+            const shading_vertex_t *v = &pfst->vertices[i * 3];
+
+            code = pfst->fill_triangle(&ps->pfs, &v[0], &v[1], &v[2]);
+        } else {
+            const patch_strip_patch_t *pp = &pfst->patches[i];
+
+            code = patch_fill(&ps->pfs, pp->curve,
+                              (pp->tensor ? pp->interior : NULL), NULL);
+        }
+    }
+    ps->code = code;
+}
+
+static int
+patch_fill_strips_flush(patch_fill_strips_t *pfst)
+{
+    int i, code = 0;
+
+    for (i = 1; i < pfst->nstrips; i++) {
+        patch_strip_t *ps = &pfst->strips[i];
+
+        if (gp_thread_start(patch_fill_strip, ps, &ps->thread) < 0)
+            ps->thread = 0;
+    }
+    /* Strips whose thread didn't start are filled here. */
+    patch_fill_strip(&pfst->strips[0]);
+    for (i = 1; i < pfst->nstrips; i++) {
+        patch_strip_t *ps = &pfst->strips[i];
+
+        if (ps->thread != 0)
+            gp_thread_finish(ps->thread);
+        else
+            patch_fill_strip(ps);
+    }
+    for (i = 0; i < pfst->nstrips && code >= 0; i++)
+        code = pfst->strips[i].code;
+    pfst->count = 0;
+    return code;
+}
+
+static void
+patch_fill_strips_free(patch_fill_strips_t *pfst)
+{
+    gs_memory_t *mem = pfst->pfs->memory;
+    int i;
+
+    for (i = 0; i < pfst->nstrips; i++) {
+        patch_strip_t *ps = &pfst->strips[i];
+
+        term_patch_fill_state(&ps->pfs);
+        gx_cpath_free(&ps->cpath, "patch_fill_strips_free");
+        if (ps->memory != mem)
+            gs_memory_chunk_release(ps->memory);
+    }
+    if (pfst->lock != NULL)
+        gx_monitor_free(pfst->lock);
+    gs_free_object(mem, pfst->colors, "patch_fill_strips_free");
+    gs_free_object(mem, pfst->vertices, "patch_fill_strips_free");
+    gs_free_object(mem, pfst->patches, "patch_fill_strips_free");
+    gs_free_object(mem, pfst->bounds, "patch_fill_strips_free");
+    gs_free_object(mem, pfst->strips, "patch_fill_strips_free");
+    gs_free_object(mem, pfst, "patch_fill_strips_free");
+}
+
+int
+patch_fill_strips_begin(patch_fill_state_t *pfs,
+        patch_fill_triangle_proc_t fill_triangle, patch_fill_strips_t **ppfst)
+{
+    gx_device *dev = pfs->dev;
+    gx_device *tdev = (gx_device_is_clip(dev) ?
+                       ((gx_device_clip *)dev)->target : dev);
+    gs_memory_t *mem = pfs->memory;
+    const int row0 = fixed2int(pfs->rect.p.y);
+    const int rows = fixed2int_ceiling(pfs->rect.q.y) - row0;
+    int threads = gs_currentfillthreads(mem);
+    gs_memory_status_t mem_status;
+    patch_fill_strips_t *pfst;
+    gx_monitor_t *function_lock;
+    int nstrips, i, code = 0;
+
+    *ppfst = NULL;
+    /* More threads than processors would only add overhead. */
+    if (threads > gp_get_cpu_count())
+        threads = gp_get_cpu_count();
+    if (threads > rows / PATCH_STRIP_MIN_ROWS)
+        threads = rows / PATCH_STRIP_MIN_ROWS;
+    if (threads < 2 || !gs_device_is_memory(tdev) ||
+        ((const gx_device_memory *)tdev)->num_planes != 0 ||
+        pfs->pis->log_op != lop_default ||
+        gx_get_cmap_procs(pfs->pis, dev)->is_halftoned(pfs->pis, dev))
+        return 0;
+    /* The chunk allocators need a thread-safe base allocator. */
+    gs_memory_status(mem->thread_safe_memory, &mem_status);
+    if (!mem_status.is_thread_safe)
+        return 0;
+    nstrips = threads;
+
+    pfst = (patch_fill_strips_t *)gs_alloc_bytes(mem, sizeof(*pfst),
+                                                 "patch_fill_strips_begin");
+    if (pfst == NULL)
+        return_error(gs_error_VMerror);
+    memset(pfst, 0, sizeof(*pfst));
+    pfst->pfs = pfs;
+    pfst->fill_triangle = fill_triangle;
+    pfst->strips = (patch_strip_t *)gs_alloc_byte_array(mem, nstrips,
+                                sizeof(patch_strip_t), "patch_fill_strips_begin");
+    pfst->bounds = (fixed *)gs_alloc_byte_array(mem, PATCH_STRIP_BATCH * 2,
+                                sizeof(fixed), "patch_fill_strips_begin");
+    if (fill_triangle != NULL) {
+        pfst->vertices = (shading_vertex_t *)gs_alloc_byte_array(mem,
+                                PATCH_STRIP_BATCH * 3, sizeof(shading_vertex_t),
+                                "patch_fill_strips_begin");
+        pfst->colors = gs_alloc_bytes(mem,
+                                PATCH_STRIP_BATCH * 3 * pfs->color_stack_step,
+                                "patch_fill_strips_begin");
+    } else
+        pfst->patches = (patch_strip_patch_t *)gs_alloc_byte_array(mem,
+                                PATCH_STRIP_BATCH, sizeof(patch_strip_patch_t),
+                                "patch_fill_strips_begin");
+    pfst->lock = gx_monitor_alloc(mem);
+    if (pfst->strips == NULL || pfst->bounds == NULL || pfst->lock == NULL ||
+        (fill_triangle != NULL ?
+         pfst->vertices == NULL || pfst->colors == NULL :
+         pfst->patches == NULL)) {
+        patch_fill_strips_free(pfst);
+        return_error(gs_error_VMerror);
+    }
+    function_lock = (pfs->Function != NULL &&
+                     function_needs_lock(pfs->Function) ? pfst->lock : NULL);
+    for (i = 0; i < nstrips; i++) {
+        patch_strip_t *ps = &pfst->strips[i];
+        gs_fixed_rect box;
+
+        ps->pfst = pfst;
+        ps->memory = mem;
+        if (i > 0 &&
+            gs_memory_chunk_wrap(&ps->memory, mem->thread_safe_memory) < 0) {
+            patch_fill_strips_free(pfst);
+            return_error(gs_error_VMerror);
+        }
+        ps->pfs = *pfs;
+        ps->pfs.wedge_vertex_list_elem_buffer = NULL;
+        ps->pfs.free_wedge_vertex = NULL;
+        ps->pfs.color_stack = NULL;
+        ps->pfs.color_stack_ptr = NULL;
+        ps->pfs.pcic = NULL;
+        ps->pfs.color_lock = pfst->lock;
+        ps->pfs.function_lock = function_lock;
+        ps->thread = 0;
+        ps->code = 0;
+        gx_cpath_init_local(&ps->cpath, mem);
+        pfst->nstrips = i + 1;
+        box.p.x = int2fixed(fixed2int(pfs->rect.p.x));
+        box.q.x = int2fixed(fixed2int_ceiling(pfs->rect.q.x));
+        box.p.y = int2fixed(row0 + (int)((long)rows * i / nstrips));
+        box.q.y = int2fixed(row0 + (int)((long)rows * (i + 1) / nstrips));
+        ps->ymin = box.p.y - PATCH_STRIP_MARGIN;
+        ps->ymax = box.q.y + PATCH_STRIP_MARGIN;
+        code = gx_cpath_from_rectangle(&ps->cpath, &box);
+        if (code >= 0)
+            code = alloc_patch_fill_memory(&ps->pfs, ps->memory, pfs->direct_space);
+        if (code < 0) {
+            patch_fill_strips_free(pfst);
+            return code;
+        }
+        if (dev != tdev) {
+            ps->cdev = *(gx_device_clip *)dev;
+            (*dev_proc(&ps->cdev, open_device))((gx_device *)&ps->cdev);
+            gx_make_clip_device_on_stack(&ps->sdev, &ps->cpath, (gx_device *)&ps->cdev);
+        } else
+            gx_make_clip_device_on_stack(&ps->sdev, &ps->cpath, dev);
+        ps->pfs.dev = (gx_device *)&ps->sdev;
+    }
+    *ppfst = pfst;
+    return 0;
+}
+
+int
+patch_fill_strips_triangle(patch_fill_strips_t *pfst,
+        const shading_vertex_t *p0, const shading_vertex_t *p1, const shading_vertex_t *p2)
+{
+    const shading_vertex_t *p[3];
+    const int step = pfst->pfs->color_stack_step;
+    shading_vertex_t *v = &pfst->vertices[pfst->count * 3];
+    fixed *bounds = &pfst->bounds[pfst->count * 2];
+    int i;
+
+    p[0] = p0, p[1] = p1, p[2] = p2;
+    for (i = 0; i < 3; i++) {
+        byte *c = pfst->colors + (pfst->count * 3 + i) * step;
+
+        memcpy(c, p[i]->c, step);
+        v[i].p = p[i]->p;
+        v[i].c = (const patch_color_t *)c;
+    }
+    bounds[0] = min(min(p0->p.y, p1->p.y), p2->p.y);
+    bounds[1] = max(max(p0->p.y, p1->p.y), p2->p.y);
+    if (++pfst->count == PATCH_STRIP_BATCH)
+        return patch_fill_strips_flush(pfst);
+    return 0;
+}
+
+int
+patch_fill_strips_patch(patch_fill_strips_t *pfst, const patch_curve_t curve[4],
+        const gs_fixed_point interior[4])
+{
+    patch_strip_patch_t *pp = &pfst->patches[pfst->count];
+    fixed *bounds = &pfst->bounds[pfst->count * 2];
+    fixed ymin = curve[0].vertex.p.y, ymax = ymin;
+    int i;
+
+    memcpy(pp->curve, curve, sizeof(pp->curve));
+    pp->tensor = (interior != NULL);
+    if (pp->tensor)
+        memcpy(pp->interior, interior, sizeof(pp->interior));
+    /* A patch lies within the convex hull of its 16 poles. */
+    for (i = 0; i < 4; i++) {
+        fixed y = curve[i].vertex.p.y;
+
+        ymin = min(ymin, y), ymax = max(ymax, y);
+        y = curve[i].control[0].y;
+        ymin = min(ymin, y), ymax = max(ymax, y);
+        y = curve[i].control[1].y;
+        ymin = min(ymin, y), ymax = max(ymax, y);
+        if (pp->tensor) {
+            y = interior[i].y;
+            ymin = min(ymin, y), ymax = max(ymax, y);
+        }
+    }
+    if (!pp->tensor) {
+        /* The inner poles of a Coons patch are affine combinations of
+           the boundary ones with negative weights summing to -1. */
+        fixed d = ymax - ymin;
+
+        ymin -= d;
+        ymax += d;
+    }
+    bounds[0] = ymin;
+    bounds[1] = ymax;
+    if (++pfst->count == PATCH_STRIP_BATCH)
+        return patch_fill_strips_flush(pfst);
+    return 0;
+}
+
+/* Fill the rest of the batch unless code < 0, and release the strips. */
+int
+patch_fill_strips_end(patch_fill_strips_t *pfst, int code)
+{
+    if (code >= 0 && pfst->count > 0) {
+        int code1 = patch_fill_strips_flush(pfst);
+
+        if (code1 < 0)
+            code = code1;
+    }
+    patch_fill_strips_free(pfst);
+    return code;
+}
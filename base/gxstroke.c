@@ -409,6 +409,115 @@ gx_join_path_and_reverse(gx_path * path, gx_path * rpath)
     return gx_path_close_subpath(path);
 }
 
+/*
+ * Thin lines don't need caps, joins or partial_line bookkeeping, so when
+ * every segment of a stroke is thin we draw the segments as they come,
+ * straight from the (flattened) path or from the dash enumerator,
+ * without building the dashed path.  This draws the same lines in the
+ * same order as the main loop of gx_stroke_path_only_aux does when the
+ * stroke has no dots: degenerate lines are skipped, dash pieces are
+ * always drawn, and gaps only move the current point.
+ */
+typedef struct thin_stroke_receiver_s {
+    gx_dash_receiver common;
+    gx_device *dev;
+    const gx_device_color *pdevc;
+    const gs_imager_state *pis;
+    fixed x, y;                 /* current point */
+    fixed sx, sy;               /* start of the current subpath */
+} thin_stroke_receiver;
+
+static int
+thin_stroke_draw(thin_stroke_receiver * prcv, fixed x, fixed y)
+{
+    int code = (*dev_proc(prcv->dev, draw_thin_line))
+                    (prcv->dev, prcv->x, prcv->y, x, y,
+                     prcv->pdevc, prcv->pis->log_op,
+                     prcv->pis->fill_adjust.x, prcv->pis->fill_adjust.y);
+
+    prcv->x = x, prcv->y = y;
+    return code;
+}
+static int
+thin_stroke_add_point(gx_dash_receiver * pdr, fixed x, fixed y)
+{
+    thin_stroke_receiver *prcv = (thin_stroke_receiver *)pdr;
+
+    prcv->x = prcv->sx = x;
+    prcv->y = prcv->sy = y;
+    return 0;
+}
+static int
+thin_stroke_add_line(gx_dash_receiver * pdr, fixed x, fixed y,
+                     segment_notes notes)
+{
+    thin_stroke_receiver *prcv = (thin_stroke_receiver *)pdr;
+
+    if (x == prcv->x && y == prcv->y)
+        return 0;
+    return thin_stroke_draw(prcv, x, y);
+}
+static int
+thin_stroke_add_dash(gx_dash_receiver * pdr, fixed x, fixed y,
+                     fixed dx, fixed dy, segment_notes notes)
+{
+    return thin_stroke_draw((thin_stroke_receiver *)pdr, x, y);
+}
+static int
+thin_stroke_close_subpath(gx_dash_receiver * pdr, segment_notes notes)
+{
+    thin_stroke_receiver *prcv = (thin_stroke_receiver *)pdr;
+
+    return thin_stroke_add_line(pdr, prcv->sx, prcv->sy, notes);
+}
+
+/* Draw a path whose segments are all thin, expanding dashes on the fly. */
+static int
+stroke_thin_path(const gx_path * ppath, gx_device * dev,
+                 const gx_device_color * pdevc, const gs_imager_state * pis,
+                 bool dashed)
+{
+    thin_stroke_receiver rcv;
+    const segment *pseg;
+    int code = 0;
+
+    rcv.common.add_point = thin_stroke_add_point;
+    rcv.common.add_line = thin_stroke_add_line;
+    rcv.common.add_dash = thin_stroke_add_dash;
+    rcv.common.close_subpath = thin_stroke_close_subpath;
+    rcv.dev = dev;
+    rcv.pdevc = pdevc;
+    rcv.pis = pis;
+    rcv.x = rcv.sx = rcv.y = rcv.sy = 0;
+    if (dashed)
+        return gx_path_enum_dash_expansion(ppath, pis, &rcv.common);
+    for (pseg = (const segment *)ppath->first_subpath;
+         pseg != 0 && code >= 0; pseg = pseg->next) {
+        switch (pseg->type) {
+            case s_start:
+                code = thin_stroke_add_point(&rcv.common,
+                                             pseg->pt.x, pseg->pt.y);
+                break;
+            case s_gap:
+                rcv.x = pseg->pt.x, rcv.y = pseg->pt.y;
+                break;
+            case s_line_close:
+                code = thin_stroke_close_subpath(&rcv.common, pseg->notes);
+                break;
+            case s_dash:
+                code = thin_stroke_add_dash(&rcv.common,
+                                            pseg->pt.x, pseg->pt.y, 0, 0,
+                                            pseg->notes);
+                break;
+            default:            /* s_line */
+                code = thin_stroke_add_line(&rcv.common,
+                                            pseg->pt.x, pseg->pt.y,
+                                            pseg->notes);
+        }
+    }
+    return code;
+}
+
 /*
  * Stroke a path.  If to_path != 0, append the stroke outline to it;
  * if to_path == 0, draw the strokes on pdev.
@@ -675,6 +784,19 @@ gx_stroke_path_only_aux(gx_path * ppath, gx_path * to_path, gx_device * pdev,
             return code;
         spath = &fpath;
     }
+    if (line_proc == stroke_fill && always_thin &&
+        pgs_lp->dot_length == 0 &&
+        pgs_lp->start_cap != gs_cap_round &&
+        pgs_lp->end_cap != gs_cap_round &&
+        pgs_lp->dash_cap != gs_cap_round &&
+        (!traditional || (pgs_lp->start_cap == gs_cap_butt &&
+                          pgs_lp->dash_cap == gs_cap_butt))
+        ) {
+        code = stroke_thin_path(spath, dev, pdevc, pis, dash_count != 0);
+        if (dev == (gx_device *)&cdev)
+            cdev.target->sgr = cdev.sgr;
+        goto exf;
+    }
     if (dash_count) {
         gx_path_init_local(&dpath, ppath->memory);
         code = gx_path_add_dash_expansion(spath, &dpath, pis);
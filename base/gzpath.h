@@ -61,36 +61,28 @@ typedef struct segment_s segment;
 typedef struct subpath_s subpath;
 
 /*
- * Define a generic segment.  This is never instantiated,
- * but we define a descriptor anyway for the benefit of subclasses.
+ * Define a generic segment.  This is never instantiated.
+ *
+ * Segments are not individually allocated objects: they are carved
+ * sequentially out of blocks owned by the path's segments object (see
+ * gx_path_segment_block below), so they have no GC descriptors, and
+ * no GC-traced structure may point to them.
  */
 struct segment_s {
     segment_common
 };
 
-#define private_st_segment()	/* in gxpath.c */\
-  gs_private_st_ptrs2(st_segment, struct segment_s, "segment",\
-    segment_enum_ptrs, segment_reloc_ptrs, prev, next)
-
 /* Line segments have no special data. */
 typedef struct {
     segment_common
 } line_segment;
 
-#define private_st_line()	/* in gxpath.c */\
-  gs_private_st_suffix_add0(st_line, line_segment, "line",\
-    line_enum_ptrs, line_reloc_ptrs, st_segment)
-
 /* Dash segments (only for internal use of the stroking algorithm). */
 typedef struct {
     segment_common
     gs_fixed_point tangent;
 } dash_segment;
 
-#define private_st_dash()	/* in gxpath.c */\
-  gs_private_st_suffix_add0(st_dash, dash_segment, "dash",\
-    dash_enum_ptrs, dash_reloc_ptrs, st_segment)
-
 /* Line_close segments are for the lines appended by closepath. */
 /* They point back to the subpath being closed. */
 typedef struct {
@@ -98,10 +90,6 @@ typedef struct {
     subpath * sub;
 } line_close_segment;
 
-#define private_st_line_close()	/* in gxpath.c */\
-  gs_private_st_suffix_add1(st_line_close, line_close_segment, "close",\
-    close_enum_ptrs, close_reloc_ptrs, st_segment, sub)
-
 /*
  * We use two different representations for curve segments: one defined by
  * two endpoints (p0, p3) and two control points (p1, p2), and one defined
@@ -129,10 +117,6 @@ typedef struct {
     gs_fixed_point p1, p2;
 } curve_segment;
 
-#define private_st_curve()	/* in gxpath.c */\
-  gs_private_st_suffix_add0_local(st_curve, curve_segment, "curve",\
-    segment_enum_ptrs, segment_reloc_ptrs, st_segment)
-
 /*
  * Define a start segment.  This serves as the head of a subpath.
  * The closer is only used temporarily when filling,
@@ -147,10 +131,6 @@ struct subpath_s {
     char /*bool */ is_closed;	/* true if subpath is closed */
 };
 
-#define private_st_subpath()	/* in gxpath.c */\
-  gs_private_st_suffix_add1(st_subpath, subpath, "subpath",\
-    subpath_enum_ptrs, subpath_reloc_ptrs, st_segment, last)
-
 /* Test whether a subpath is a rectangle; if so, also return */
 /* the start of the next subpath. */
 gx_path_rectangular_type
@@ -256,19 +236,40 @@ typedef enum {
  * cause too much disruption to existing code.)  However, we need to put at
  * least first_subpath and current_subpath in this structure so that we can
  * free the segments when the reference count becomes zero.
+ *
+ * The segments themselves live in a chain of blocks of non-GC memory,
+ * also recorded in the contents, which are allocated sequentially and
+ * freed all at once with the segments object.  The newest block, from
+ * which segments are currently being allocated, is first in the chain.
+ * A segment unlinked by in-place editing just stays in its block.
  */
+typedef struct gx_path_segment_block_s gx_path_segment_block;
+struct gx_path_segment_block_s {
+    gx_path_segment_block *next;	/* next older block */
+    gs_memory_t *memory;	/* (non-GC) allocator of this block */
+    uint size;			/* # of bytes for segments */
+    uint used;			/* # of bytes allocated */
+    /* segment data follows, aligned */
+};
+
 typedef struct gx_path_segments_s {
     rc_header rc;
     struct psc_ {
         subpath *subpath_first;
         subpath *subpath_current;
+        gx_path_segment_block *blocks;
     } contents;
 } gx_path_segments;
 
 #define private_st_path_segments()	/* in gxpath.c */\
-  gs_private_st_ptrs2(st_path_segments, gx_path_segments, "path segments",\
-    path_segments_enum_ptrs, path_segments_reloc_ptrs,\
-    contents.subpath_first, contents.subpath_current)
+  gs_private_st_simple_final(st_path_segments, gx_path_segments,\
+    "path segments", path_segments_finalize)
+
+/*
+ * Release a segment unlinked from the path.  The storage is reused
+ * only if it was the most recently allocated one.
+ */
+void gx_path_release_segment(gx_path * ppath, segment * pseg);
 
 /* Record how a path was allocated, so freeing will do the right thing. */
 typedef enum {
@@ -336,9 +337,9 @@ struct gx_path_s {
 /* st_path should be static, but it's needed for the clip_path subclass. */
 extern_st(st_path);
 #define public_st_path()	/* in gxpath.c */\
-  gs_public_st_ptrs3(st_path, gx_path, "path",\
-    path_enum_ptrs, path_reloc_ptrs, segments, box_last, last_charpath_segment)
-#define st_path_max_ptrs 3
+  gs_public_st_ptrs1(st_path, gx_path, "path",\
+    path_enum_ptrs, path_reloc_ptrs, segments)
+#define st_path_max_ptrs 1
 
 /* Path enumeration structure */
 struct gs_path_enum_s {
@@ -356,8 +357,8 @@ struct gs_path_enum_s {
 /* We export st_path_enum only so that st_cpath_enum can subclass it. */
 extern_st(st_path_enum);
 #define public_st_path_enum()	/* in gxpath2.c */\
-  gs_public_st_ptrs3(st_path_enum, gs_path_enum, "gs_path_enum",\
-    path_enum_enum_ptrs, path_enum_reloc_ptrs, pseg, path, copied_path)
+  gs_public_st_ptrs2(st_path_enum, gs_path_enum, "gs_path_enum",\
+    path_enum_enum_ptrs, path_enum_reloc_ptrs, path, copied_path)
 
 /* Inline path accessors. */
 #define gx_path_has_curves_inline(ppath)\
@@ -402,6 +403,8 @@ bool gx_flattened_iterator__init_line(gx_flattened_iterator *this,
             fixed x0, fixed y0, fixed x1, fixed y1);
 void gx_flattened_iterator__switch_to_backscan(gx_flattened_iterator *this, bool not_first);
 int  gx_flattened_iterator__next(gx_flattened_iterator *this);
+int  gx_flattened_iterator__next_points(gx_flattened_iterator *this,
+            gs_fixed_point *points, int max_count, int *pcount);
 int  gx_flattened_iterator__prev(gx_flattened_iterator *this);
 
 bool curve_coeffs_ranged(fixed x0, fixed x1, fixed x2, fixed x3,
@@ -110,6 +110,17 @@ extern const cfd_node cf_white_decode[];
 #define cfd_black_min_bits 2	/* shortest black run */
 extern const cfd_node cf_black_decode[];
 
+/*
+ * Single-level tables for decoding white and black runs in one lookup
+ * when enough input is buffered.  The index is the next cfd_xxx_wide_bits
+ * bits of input; code_length is the full length of the code.
+ */
+#define cfd_white_wide_bits 12	/* longest white code */
+extern const cfd_node cf_white_decode_wide[];
+
+#define cfd_black_wide_bits 13	/* longest black code */
+extern const cfd_node cf_black_decode_wide[];
+
 #define cfd_2d_initial_bits 7
 #define cfd_2d_min_bits 4	/* shortest non-H/V 2-D run */
 extern const cfd_node cf_2d_decode[];
@@ -17,6 +17,7 @@
 /* CCITTFax decoding filter */
 #include "stdio_.h"		/* includes std.h */
 #include "memory_.h"
+#include "stdint_.h"
 #include "gdebug.h"
 #include "strimpl.h"
 #include "scf.h"
@@ -44,6 +45,7 @@ s_CFD_init(stream_state * st)
         ROUND_UP((ss->Columns + 7) >> 3, ss->DecodedByteAlign);
     byte white = (ss->BlackIs1 ? 0 : 0xff);
 
+    ss->ref_changes = 0;
     s_hcd_init_inline(ss);
     /* Because skip_white_pixels can look as many as 4 bytes ahead, */
     /* we need to allow 4 extra bytes at the end of the row buffers. */
@@ -60,7 +62,16 @@ s_CFD_init(stream_state * st)
         memset(ss->lprev, white, raster + 4); /* + 4 for Valgrind */
         /* Ensure that the scan of the reference line will stop. */
         ss->lprev[raster] = 0xa0;
+        /* A line has fewer changing elements than pixels; */
+        /* allow for 2 sentinels. */
+        ss->ref_changes = (int *)gs_alloc_byte_array(st->memory,
+                                                     raster * 8 + 2, sizeof(int),
+                                                     "CFD ref_changes");
+        if (ss->ref_changes == 0)
+            return ERRC;	/****** WRONG ******/
     }
+    ss->ref_count = -1;
+    ss->ref_index = 0;
     ss->k_left = min(ss->K, 0);
     ss->run_color = 0;
     ss->damaged_rows = 0;
@@ -82,6 +93,7 @@ s_CFD_release(stream_state * st)
 {
     stream_CFD_state *const ss = (stream_CFD_state *) st;
 
+    gs_free_object(st->memory, ss->ref_changes, "CFD ref_changes(close)");
     gs_free_object(st->memory, ss->lprev, "CFD lprev(close)");
     gs_free_object(st->memory, ss->lbuf, "CFD lbuf(close)");
 }
@@ -150,6 +162,36 @@ s_CFD_release(stream_state * st)
         runlen = np->run_length;\
     END
 
+/*
+ * Get a run using a single-level table if at least wide_bits of input
+ * can be buffered, falling back to get_run near the end of the buffer.
+ */
+#if hc_bits_size >= 32
+#  define get_run_wide(wdecode, wide_bits, decode, initial_bits, min_bits, runlen, str, locl, outl)\
+    BEGIN\
+        if (bits_left < wide_bits && rlimit - p >= 2) {\
+            if (ss->FirstBitLowOrder)\
+                bits = (bits << 16) + ((uint)byte_reverse_bits[p[1]] << 8) + byte_reverse_bits[p[2]];\
+            else\
+                bits = (bits << 16) + ((uint)p[1] << 8) + p[2];\
+            bits_left += 16, p += 2;\
+        }\
+        if (bits_left >= wide_bits) {\
+            const cfd_node *np = &wdecode[peek_bits(wide_bits)];\
+\
+            if_debug4('W', "%s code=0x%x,%d rlen=%d\n", str,\
+                      peek_bits(np->code_length), np->code_length,\
+                      np->run_length);\
+            skip_bits(np->code_length);\
+            runlen = np->run_length;\
+        } else\
+            get_run(decode, initial_bits, min_bits, runlen, str, locl, outl);\
+    END
+#else
+#  define get_run_wide(wdecode, wide_bits, decode, initial_bits, min_bits, runlen, str, locl, outl)\
+    get_run(decode, initial_bits, min_bits, runlen, str, locl, outl)
+#endif
+
 /* Skip data bits for a white run. */
 /* rlen is either less than 64, or a multiple of 64. */
 #define skip_data(rlen, makeup_label)\
@@ -288,6 +330,7 @@ s_CFD_process(stream_state * st, stream_cursor_read * pr,
 
             ss->lprev = ss->lbuf;
             ss->lbuf = prev_bits;
+            ss->ref_count = -1;
             if (ss->K > 0)
                 k_left = (k_left == 0 ? ss->K : k_left) - 1;
         }
@@ -460,7 +503,8 @@ cf_decode_1d(stream_CFD_state * ss, stream_cursor_read * pr)
     if (q_at_stop())
         goto done;
   dw:				/* Decode a white run. */
-    get_run(cf_white_decode, cfd_white_initial_bits, cfd_white_min_bits,
+    get_run_wide(cf_white_decode_wide, cfd_white_wide_bits,
+            cf_white_decode, cfd_white_initial_bits, cfd_white_min_bits,
             bcnt, "[w1]white", dwl, out0);
     if (bcnt < 0) {		/* exceptional situation */
         switch (bcnt) {
@@ -488,7 +532,8 @@ cf_decode_1d(stream_CFD_state * ss, stream_cursor_read * pr)
     }
     run_color = 1;
   db:				/* Decode a black run. */
-    get_run(cf_black_decode, cfd_black_initial_bits, cfd_black_min_bits,
+    get_run_wide(cf_black_decode_wide, cfd_black_wide_bits,
+            cf_black_decode, cfd_black_initial_bits, cfd_black_min_bits,
             bcnt, "[w1]black", dbl, out1);
     if (bcnt < 0) {		/* All exceptional codes are invalid here. */
         /****** WRONG, uncompressed IS ALLOWED ******/
@@ -522,6 +567,71 @@ cf_decode_1d(stream_CFD_state * ss, stream_cursor_read * pr)
     goto out;
 }
 
+/* Return the number of leading 0-bits in a non-zero 64-bit word. */
+static inline int
+cf_leading_zeros(uint64_t w)
+{
+    int n = 0;
+
+    if (!(w >> 32))
+        n = 32, w <<= 32;
+    if (!(w >> 48))
+        n += 16, w <<= 16;
+    if (!(w >> 56))
+        n += 8, w <<= 8;
+    return n + byte_bit_run_length_0[(byte)~(w >> 56)];
+}
+
+/*
+ * Find the changing elements of the reference line, i.e. the pixels
+ * (up to width) whose color differs from that of the pixel to their left,
+ * taking the pixel to the left of the line as white.  We look at 64 pixels
+ * at a time, so that the long runs that make up most of a typical line
+ * cost one test per word rather than a scan per code.
+ */
+static void
+cf_compute_ref_changes(stream_CFD_state * ss, int width)
+{
+    const byte *p = ss->lprev;
+    /* Normalize the data so that black is 1. */
+    uint64_t flip = (ss->BlackIs1 ? 0 : ~(uint64_t)0);
+    int *changes = ss->ref_changes;
+    int n = 0;
+    uint left = 0;		/* color of the pixel left of the word */
+    int x;
+
+    for (x = 0; x < width; x += 64, p += 8) {
+        uint64_t w, t;
+
+        if (width - x >= 64)
+            w = ((uint64_t)p[0] << 56) + ((uint64_t)p[1] << 48) +
+                ((uint64_t)p[2] << 40) + ((uint64_t)p[3] << 32) +
+                ((uint64_t)p[4] << 24) + ((uint64_t)p[5] << 16) +
+                ((uint64_t)p[6] << 8) + p[7];
+        else {
+            int i, nbytes = (width - x + 7) >> 3;
+
+            for (w = 0, i = 0; i < 8; i++)
+                w = (w << 8) + (i < nbytes ? p[i] : 0);
+        }
+        w ^= flip;
+        t = w ^ ((w >> 1) + ((uint64_t)left << 63));
+        left = (uint)w & 1;
+        while (t != 0) {
+            int k = cf_leading_zeros(t);
+
+            if (x + k >= width)
+                break;
+            changes[n++] = x + k;
+            t ^= ((uint64_t)1 << 63) >> k;
+        }
+    }
+    changes[n] = changes[n + 1] = width;
+    ss->ref_count = n;
+    ss->ref_index = 0;
+    if_debug2('W', "[w2]reference line: %d changes, width %d\n", n, width);
+}
+
 /* Decode a 2-D scan line. */
 static int
 cf_decode_2d(stream_CFD_state * ss, stream_cursor_read * pr)
@@ -533,9 +643,9 @@ cf_decode_2d(stream_CFD_state * ss, stream_cursor_read * pr)
     int end_count = -ss->Columns & 7;
     uint raster = ss->raster;
     byte *q0 = ss->lbuf;
-    byte *prev_q01 = ss->lprev + 1;
     byte *endptr = q0 - 1 + raster;
     int init_count = raster << 3;
+    int width = init_count - end_count;	/* pixels in the line */
     register int count;
     int rlen;
     int status;
@@ -544,6 +654,8 @@ cf_decode_2d(stream_CFD_state * ss, stream_cursor_read * pr)
     count = ((endptr - q) << 3) + qbit;
     endptr[1] = 0xa0;		/* a byte with some 0s and some 1s, */
     /* to ensure run scan will stop */
+    if (ss->ref_count < 0)
+        cf_compute_ref_changes(ss, width);
     if_debug1('W', "[w2]raster=%d\n", raster);
     switch (ss->run_color) {
         case -2:
@@ -634,54 +746,48 @@ v0:	    skip_bits(1);
                         goto out;
                 }
     }
-    /* Interpreting the run requires scanning the */
-    /* previous ('reference') line. */
+    /*
+     * Interpreting the run requires locating changing elements of the
+     * previous ('reference') line.  b1 is the first changing element to
+     * the right of a0 whose color is opposite to a0's: for this purpose
+     * a0 is x0 = init_count - count, except that at the start of a (white)
+     * line a changing element at x0 itself qualifies.  b2 is the next
+     * changing element after b1.  Elements past the end of the line are
+     * taken as the end of the line.
+     */
     {
-        int prev_count = count;
-        byte prev_data;
+        const int *changes = ss->ref_changes;
+        int x0 = init_count - count;
+        int cur_black = (invert != invert_white);
+        int i = ss->ref_index;
+        int b1, prev_count;
         int dlen;
-        static const byte count_bit[8] =
-        {0x80, 1, 2, 4, 8, 0x10, 0x20, 0x40};
-        byte *prev_q = prev_q01 + (q - q0);
-        int plen;
-
-        if (!(count & 7))
-            prev_q++;		/* because of skip macros */
-        prev_data = prev_q[-1] ^ invert;
-        /* Find the b1 transition. */
-        if ((prev_data & count_bit[prev_count & 7]) &&
-            (prev_count < init_count || invert != invert_white)
-            ) {			/* Look for changing white first. */
-            if_debug1('W', " data=0x%x", prev_data);
-            skip_black_pixels(prev_data, prev_q,
-                              prev_count, invert, plen);
-            if (prev_count < end_count)		/* overshot */
-                prev_count = end_count;
-            if_debug1('W', " b1 other=%d", prev_count);
-        }
-        if (prev_count != end_count) {
-            if_debug1('W', " data=0x%x", prev_data);
-            skip_white_pixels(prev_data, prev_q,
-                              prev_count, invert, plen);
-            if (prev_count < end_count)		/* overshot */
-                prev_count = end_count;
-            if_debug1('W', " b1 same=%d", prev_count);
-        }
-        /* b1 = prev_count; */
+
+        /* Find the first changing element to the right of x0. */
+        while (changes[i] <= x0)
+            i++;
+        while (i > 0 && changes[i - 1] > x0)	/* a0 moved left */
+            i--;
+        ss->ref_index = i;
+        /* Reference pixel x0 is black iff i is odd. */
+        if ((i & 1) == cur_black)	/* same color as a0 */
+            b1 = changes[i++];
+        else if (x0 > 0 || cur_black) {	/* skip the opposite color run */
+            b1 = changes[i++];
+            if (b1 < width)
+                b1 = changes[i++];
+        } else			/* black pixel at the start of the line */
+            b1 = x0;
+        if_debug2('W', " x0=%d b1=%d", x0, b1);
         if (rlen == run2_pass) {	/* Pass mode.  Find b2. */
-            if (prev_count != end_count) {
-                if_debug1('W', " data=0x%x", prev_data);
-                skip_black_pixels(prev_data, prev_q,
-                                  prev_count, invert, plen);
-                if (prev_count < end_count)	/* overshot */
-                    prev_count = end_count;
-            }
+            /* If b1 < width, b1 is changes[i - 1]. */
+            prev_count = init_count - (b1 < width ? changes[i] : width);
             /* b2 = prev_count; */
             if_debug2('W', " b2=%d, pass %d\n",
                       prev_count, count - prev_count);
         } else {		/* Vertical coding. */
             /* Remember that count counts *down*. */
-            prev_count += rlen - vertical_0;	/* a1 */
+            prev_count = init_count - b1 + rlen - vertical_0;	/* a1 */
             if_debug2('W', " vertical %d -> %d\n",
                       rlen - vertical_0, prev_count);
         }
@@ -719,7 +825,8 @@ v0:	    skip_bits(1);
      * branch back into it if we run out of input data.
      */
     /* White, then black. */
-  hww:get_run(cf_white_decode, cfd_white_initial_bits, cfd_white_min_bits,
+  hww:get_run_wide(cf_white_decode_wide, cfd_white_wide_bits,
+              cf_white_decode, cfd_white_initial_bits, cfd_white_min_bits,
               rlen, " white", wwl, outww);
     if ((count -= rlen) < end_count) {
         status = ERRC;
@@ -727,7 +834,8 @@ v0:	    skip_bits(1);
     }
     skip_data(rlen, hww);
     /* Handle the second half of a white-black horizontal code. */
-  hwb:get_run(cf_black_decode, cfd_black_initial_bits, cfd_black_min_bits,
+  hwb:get_run_wide(cf_black_decode_wide, cfd_black_wide_bits,
+              cf_black_decode, cfd_black_initial_bits, cfd_black_min_bits,
               rlen, " black", wbl, outwb);
     if ((count -= rlen) < end_count) {
         status = ERRC;
@@ -740,7 +848,8 @@ v0:	    skip_bits(1);
   outwb:ss->run_color = 1;
     goto out0;
     /* Black, then white. */
-  hbb:get_run(cf_black_decode, cfd_black_initial_bits, cfd_black_min_bits,
+  hbb:get_run_wide(cf_black_decode_wide, cfd_black_wide_bits,
+              cf_black_decode, cfd_black_initial_bits, cfd_black_min_bits,
               rlen, " black", bbl, outbb);
     if ((count -= rlen) < end_count) {
         status = ERRC;
@@ -748,7 +857,8 @@ v0:	    skip_bits(1);
     }
     invert_data(rlen, black_byte, goto hbb, ihbb);
     /* Handle the second half of a black-white horizontal code. */
-  hbw:get_run(cf_white_decode, cfd_white_initial_bits, cfd_white_min_bits,
+  hbw:get_run_wide(cf_white_decode_wide, cfd_white_wide_bits,
+              cf_white_decode, cfd_white_initial_bits, cfd_white_min_bits,
               rlen, " white", bwl, outbw);
     if ((count -= rlen) < end_count) {
         status = ERRC;
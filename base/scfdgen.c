@@ -23,6 +23,7 @@
 typedef void (*cfd_node_proc) (cfd_node *, cfd_node *, uint, int, int, int);
 typedef void (*cfd_enum_proc) (cfd_node_proc, cfd_node *, cfd_node *, int);
 static void cfd_build_tree(cfd_node *, cfd_enum_proc, int, FILE *);
+static void cfd_build_wide_table(cfd_node *, cfd_enum_proc, int, int, FILE *);
 static void cfd_enumerate_white(cfd_node_proc, cfd_node *, cfd_node *, int);
 static void cfd_enumerate_black(cfd_node_proc, cfd_node *, cfd_node *, int);
 static void cfd_enumerate_2d(cfd_node_proc, cfd_node *, cfd_node *, int);
@@ -52,6 +53,16 @@ main()
     fputs("const cfd_node cf_2d_decode[] = {\n", out);
     cfd_build_tree(area, cfd_enumerate_2d, cfd_2d_initial_bits, out);
     fputs("\n};\n\n", out);
+    fputs("/* Single-level white decoding table. */\n", out);
+    fputs("const cfd_node cf_white_decode_wide[] = {\n", out);
+    cfd_build_wide_table(area, cfd_enumerate_white, cfd_white_initial_bits,
+                         cfd_white_wide_bits, out);
+    fputs("\n};\n\n", out);
+    fputs("/* Single-level black decoding table. */\n", out);
+    fputs("const cfd_node cf_black_decode_wide[] = {\n", out);
+    cfd_build_wide_table(area, cfd_enumerate_black, cfd_black_initial_bits,
+                         cfd_black_wide_bits, out);
+    fputs("\n};\n\n", out);
     fputs("/* Uncompresssed decoding table. */\n", out);
     fputs("const cfd_node cf_uncompressed_decode[] = {\n", out);
     cfd_build_tree(area, cfd_enumerate_uncompressed, cfd_uncompressed_initial_bits, out);
@@ -180,18 +191,17 @@ cfd_enumerate_uncompressed(cfd_node_proc proc, cfd_node * tree, cfd_node * extn,
     }
 }
 
-/* Build and write out the table. */
-static void
-cfd_build_tree(cfd_node * tree, cfd_enum_proc enum_proc, int initial_bits,
-               FILE * f)
+/* Construct both levels of the tree; return the second level. */
+static cfd_node *
+cfd_construct_tree(cfd_node * tree, cfd_enum_proc enum_proc, int initial_bits,
+                   int *pnext)
 {
     cfd_node *np;
-    const char *prev = "";
     int i, next;
     cfd_node *extn;
 
     memset(tree, 0, sizeof(cfd_node) << initial_bits);
-    /* Construct and write the first level of the tree. */
+    /* Construct the first level of the tree. */
     (*enum_proc) (cfd_count_nodes, tree, (cfd_node *) 0, initial_bits);
     next = 0;
     for (i = 0, np = tree; i < 1 << initial_bits; i++, np++) {
@@ -199,16 +209,65 @@ cfd_build_tree(cfd_node * tree, cfd_enum_proc enum_proc, int initial_bits,
             np->run_length = next + (1 << initial_bits);
             next += 1 << (np->code_length - initial_bits);
         }
-        fprintf(f, "%s\t{ %d, %d }", prev, np->run_length, np->code_length);
-        prev = ",\n";
     }
-    /* Construct and write the second level. */
+    /* Construct the second level. */
     extn = (cfd_node *) malloc(sizeof(cfd_node) * next);
     for (i = 0, np = extn; i < next; i++, np++)
         np->run_length = run_error,
             np->code_length = 0;
     (*enum_proc) (cfd_init2_nodes, tree, extn, initial_bits);
+    *pnext = next;
+    return extn;
+}
+
+/* Build and write out the table. */
+static void
+cfd_build_tree(cfd_node * tree, cfd_enum_proc enum_proc, int initial_bits,
+               FILE * f)
+{
+    cfd_node *np;
+    const char *prev = "";
+    int i, next;
+    cfd_node *extn = cfd_construct_tree(tree, enum_proc, initial_bits, &next);
+
+    for (i = 0, np = tree; i < 1 << initial_bits; i++, np++) {
+        fprintf(f, "%s\t{ %d, %d }", prev, np->run_length, np->code_length);
+        prev = ",\n";
+    }
     for (i = 0, np = extn; i < next; i++, np++)
         fprintf(f, ",\n\t{ %d, %d }", np->run_length, np->code_length);
     free((char *)extn);
 }
+
+/*
+ * Build and write out a single-level table indexed by the next wide_bits
+ * bits of input, equivalent to looking the code up in the two-level tree.
+ * The code_length is the total length of the code; wide_bits must be at
+ * least the length of the longest code.
+ */
+static void
+cfd_build_wide_table(cfd_node * tree, cfd_enum_proc enum_proc,
+                     int initial_bits, int wide_bits, FILE * f)
+{
+    int next;
+    cfd_node *extn = cfd_construct_tree(tree, enum_proc, initial_bits, &next);
+    uint code;
+
+    for (code = 0; code < 1 << wide_bits; code++) {
+        const cfd_node *np = &tree[code >> (wide_bits - initial_bits)];
+        int run_length = np->run_length, code_length = np->code_length;
+
+        if (code_length > initial_bits) {
+            int xbits = code_length - initial_bits;
+            uint xcode = (code >> (wide_bits - code_length)) &
+                ((1 << xbits) - 1);
+
+            np = &extn[np->run_length - (1 << initial_bits) + xcode];
+            run_length = np->run_length;
+            code_length = initial_bits + np->code_length;
+        }
+        fprintf(f, "%s{ %d, %d }", (code == 0 ? "\t" : code & 7 ? ", " : ",\n\t"),
+                run_length, code_length);
+    }
+    free((char *)extn);
+}
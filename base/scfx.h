@@ -115,13 +115,24 @@ typedef struct stream_CFD_state_s {
     int uncomp_left;		/* # of bits left in the run */
     int uncomp_exit;		/* non-0 iff this is an exit run
                                    (-1 if next run white, 1 if black) */
+    /*
+     * For 2-D decoding, the changing elements of the reference line
+     * (lprev), as pixel positions in increasing order, followed by
+     * sentinels at the end of the line.  These are computed from lprev
+     * when the first 2-D code of a row is decoded.
+     */
+    int *ref_changes;
+    int ref_count;		/* # of changing elements (excluding the
+                                   sentinels), -1 if not computed yet */
+    int ref_index;		/* index of the first element to the right
+                                   of the last a0, as a search hint */
 } stream_CFD_state;
 
 #define private_st_CFD_state()	/* in scfd.c */\
-  gs_private_st_ptrs2(st_CFD_state, stream_CFD_state, "CCITTFaxDecode state",\
-    cfd_enum_ptrs, cfd_reloc_ptrs, lbuf, lprev)
+  gs_private_st_ptrs3(st_CFD_state, stream_CFD_state, "CCITTFaxDecode state",\
+    cfd_enum_ptrs, cfd_reloc_ptrs, lbuf, lprev, ref_changes)
 #define s_CFD_set_defaults_inline(ss)\
-  s_CF_set_defaults_inline(ss)
+  (s_CF_set_defaults_inline(ss), (ss)->ref_changes = 0)
 extern const stream_template s_CFD_template;
 
 #endif /* scfx_INCLUDED */
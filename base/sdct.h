@@ -94,6 +94,7 @@ typedef struct jpeg_decompress_data_s {
     bool faked_eoi;		/* true when fill_input_buffer inserted EOI */
     byte *scanline_buffer;	/* buffer for oversize scanline, or NULL */
     uint bytes_in_scanline;	/* # of bytes remaining to output from same */
+    struct dctd_mt_state_s *mt;	/* restart-parallel decoding, or NULL */
 } jpeg_decompress_data;
 
 #define private_st_jpeg_decompress_data()	/* in zfdctd.c */\
@@ -111,6 +112,8 @@ typedef struct stream_DCT_state_s {
     float QFactor;
     int ColorTransform;		/* -1 if not specified */
     bool NoMarker;		/* DCTEncode only */
+    int DecodeThreads;		/* DCTDecode only, set by the caller, */
+                                /* see sdctd.c */
     gs_memory_t *jpeg_memory;	/* heap for library allocations */
     /* This is a pointer to immovable storage. */
     union _jd {
@@ -20,10 +20,13 @@
 #include "jpeglib_.h"
 #include "jerror_.h"
 #include "gdebug.h"
+#include "gserrors.h"
 #include "gsmemory.h"
 #include "strimpl.h"
 #include "sdct.h"
 #include "sjpeg.h"
+#include "gpsync.h"
+#include "gsmchunk.h"
 
 /* ------ DCTDecode ------ */
 
@@ -75,6 +78,638 @@ dctd_term_source(j_decompress_ptr dinfo)
 {
 }
 
+/* ------ Parallel decoding at restart markers ------ */
+
+/*
+ * If DecodeThreads > 1, a single-scan sequential Huffman JPEG that has
+ * a restart interval is decoded in parallel, with at most one thread per
+ * processor.  DecodeThreads is not a filter parameter: the caller sets it
+ * from the DCTDecodeThreads system parameter, so a document can't ask
+ * for more threads (and buffers) than the user allowed.  The header is recorded
+ * while it is parsed, then the entropy-coded data is buffered up to the
+ * EOI, noting where each RSTn marker falls.  Runs of MCU rows that start
+ * and end on restart boundaries are presented to private IJG
+ * decompressors as images in their own right: the recorded header with
+ * the SOF height patched, the segments with their markers renumbered
+ * from RST0, and an EOI.  Restart markers reset the DC predictors, and
+ * this configuration of the library neither smooths nor interpolates
+ * across rows, so the result is identical to a sequential decode.
+ *
+ * Chunks are decoded a wave at a time (one per thread) into row buffers
+ * that are then copied out in order.  If anything is not as expected --
+ * marker numbering, a worker error -- the main decompressor reads the
+ * buffered data sequentially from the first row not yet delivered, so
+ * errors and warnings are reported exactly as they would be otherwise.
+ */
+
+/* Aim for decoded chunks of about this many bytes. */
+#define DCTD_MT_CHUNK_BYTES 262144
+
+#if JPEG_LIB_VERSION >= 70
+#  define DCTD_BLOCK_SIZE(dinfo) ((dinfo)->block_size)
+#else
+#  define DCTD_BLOCK_SIZE(dinfo) DCTSIZE
+#endif
+
+typedef struct dctd_mt_state_s dctd_mt_state_t;
+
+typedef struct dctd_mt_slot_s {
+    dctd_mt_state_t *mt;
+    gs_memory_t *memory;	/* chunk allocator for this thread */
+    stream_DCT_state st;	/* only the fields used by sjpegd.c */
+    jpeg_decompress_data jd;
+    bool created;		/* jd.dinfo has been created */
+    gp_thread_id thread;
+    int first_row, nrows;
+    int first_seg, nsegs;
+    int piece;			/* next piece of the synthetic input */
+    byte height[2];		/* patched SOF height */
+    byte marker[2];		/* renumbered RSTn */
+    byte *rows;			/* decoded rows */
+    int code;
+} dctd_mt_slot_t;
+
+struct dctd_mt_state_s {
+    gs_memory_t *memory;	/* non-GC memory for the buffers */
+    int nthreads;
+    byte *header;		/* SOI through the SOS segment */
+    uint header_size, header_max;
+    uint sof_height;		/* offset of the height in the SOF */
+    byte *data;			/* entropy-coded data and final marker */
+    ulong data_size, data_max;
+    ulong *seg;			/* seg[i] = offset of restart segment i, */
+                                /* seg[nseg] = end of final marker */
+    int nseg, seg_max;
+    bool after_ff;		/* last byte gathered was 0xFF */
+    bool valid;			/* RSTn markers are numbered correctly */
+    int end_marker;		/* marker that ended the scan, or -1 */
+    J_COLOR_SPACE jpeg_color_space, out_color_space;
+    uint scan_line_size;
+    int mcus_per_row, mcu_height, mcu_rows, chunk_mcu_rows;
+    int nchunks, next_chunk;
+    dctd_mt_slot_t *slots;
+    int nslots, wave_slots;	/* # of slots in the current wave */
+    int emit_slot, emit_row;
+    bool sequential;		/* main decompressor reads mt->data */
+    byte *seq_row;
+    int rows_done;		/* rows taken from the buffers */
+    const byte *row;
+    uint row_left;
+};
+
+/* Append bytes to a growable buffer. */
+static int
+dctd_mt_append(gs_memory_t *mem, byte **pbuf, ulong *psize, ulong *pmax,
+               const byte *p, ulong n)
+{
+    if (*psize + n > *pmax) {
+        ulong max = max(*pmax * 2, *psize + n + 4096);
+        byte *buf = gs_alloc_bytes(mem, max, "dctd_mt_append");
+
+        if (buf == 0)
+            return_error(gs_error_VMerror);
+        if (*psize)
+            memcpy(buf, *pbuf, *psize);
+        gs_free_object(mem, *pbuf, "dctd_mt_append");
+        *pbuf = buf;
+        *pmax = max;
+    }
+    memcpy(*pbuf + *psize, p, n);
+    *psize += n;
+    return 0;
+}
+
+/* Record header bytes consumed by the main decompressor. */
+static int
+dctd_mt_record(jpeg_decompress_data *jddp, const byte *p, ulong n)
+{
+    dctd_mt_state_t *mt = jddp->mt;
+    ulong size = mt->header_size, hmax = mt->header_max;
+    int code = dctd_mt_append(mt->memory, &mt->header, &size, &hmax, p, n);
+
+    mt->header_size = size;
+    mt->header_max = hmax;
+    return code;
+}
+
+/* Note the start of a restart segment. */
+static int
+dctd_mt_add_seg(dctd_mt_state_t *mt, ulong offset)
+{
+    if (mt->nseg == mt->seg_max) {
+        int max = mt->seg_max * 2 + 64;
+        ulong *seg = (ulong *)gs_alloc_byte_array(mt->memory, max,
+                                sizeof(ulong), "dctd_mt_add_seg");
+
+        if (seg == 0)
+            return_error(gs_error_VMerror);
+        if (mt->nseg)
+            memcpy(seg, mt->seg, mt->nseg * sizeof(ulong));
+        gs_free_object(mt->memory, mt->seg, "dctd_mt_add_seg");
+        mt->seg = seg;
+        mt->seg_max = max;
+    }
+    mt->seg[mt->nseg++] = offset;
+    return 0;
+}
+
+/* Free the parallel decoding state. */
+static void
+dctd_mt_free(jpeg_decompress_data *jddp)
+{
+    dctd_mt_state_t *mt = jddp->mt;
+    gs_memory_t *mem;
+    int i;
+
+    if (mt == 0)
+        return;
+    mem = mt->memory;
+    for (i = 0; i < mt->nslots; i++) {
+        dctd_mt_slot_t *slot = &mt->slots[i];
+
+        if (slot->created)
+            gs_jpeg_destroy(&slot->st);
+        if (slot->memory != 0)
+            gs_memory_chunk_release(slot->memory);
+        gs_free_object(mem, slot->rows, "dctd_mt_free(rows)");
+    }
+    gs_free_object(mem, mt->slots, "dctd_mt_free(slots)");
+    gs_free_object(mem, mt->seq_row, "dctd_mt_free(seq_row)");
+    gs_free_object(mem, mt->seg, "dctd_mt_free(seg)");
+    gs_free_object(mem, mt->data, "dctd_mt_free(data)");
+    gs_free_object(mem, mt->header, "dctd_mt_free(header)");
+    gs_free_object(mem, mt, "dctd_mt_free");
+    jddp->mt = 0;
+}
+
+/* Find the offset of the image height in a baseline or extended SOF. */
+static uint
+dctd_mt_find_sof_height(const byte *h, uint size)
+{
+    uint i = 2;
+
+    while (i + 4 <= size) {
+        int c = h[i + 1];
+
+        if (h[i] != 0xFF || c == 0xFF) {
+            i++;		/* fill or garbage */
+            continue;
+        }
+        if (c == 0xC0 || c == 0xC1)
+            return (i + 7 <= size ? i + 5 : 0);
+        if ((c >= JPEG_RST0 && c <= JPEG_RST0 + 7) || c == 0x01)
+            i += 2;
+        else
+            i += 2 + ((h[i + 2] << 8) | h[i + 3]);
+    }
+    return 0;
+}
+
+/*
+ * Decide whether to decode the image in parallel, once the header has been
+ * read.  If not, free the parallel state so decoding carries on as usual.
+ */
+static int
+dctd_mt_begin(stream_DCT_state *ss)
+{
+    jpeg_decompress_data *jddp = ss->data.decompress;
+    dctd_mt_state_t *mt = jddp->mt;
+    j_decompress_ptr dinfo = &jddp->dinfo;
+    gs_memory_status_t mem_status;
+    long chunk_bytes;
+    int ri = dinfo->restart_interval, mcu_width, a, b, unit, units, code;
+
+    if (dinfo->progressive_mode || dinfo->arith_code || ri == 0 ||
+        dinfo->comps_in_scan != dinfo->num_components ||
+        (dinfo->comps_in_scan == 1 &&
+         (dinfo->max_h_samp_factor != 1 || dinfo->max_v_samp_factor != 1)) ||
+        (mt->sof_height = dctd_mt_find_sof_height(mt->header,
+                                                  mt->header_size)) == 0)
+        goto no;
+    if ((code = gs_jpeg_calc_output_dimensions(ss)) < 0)
+        return code;
+    mt->scan_line_size = dinfo->output_width * dinfo->output_components;
+    mcu_width = dinfo->max_h_samp_factor * DCTD_BLOCK_SIZE(dinfo);
+    mt->mcus_per_row = (dinfo->image_width + mcu_width - 1) / mcu_width;
+    mt->mcu_height = dinfo->max_v_samp_factor * DCTD_BLOCK_SIZE(dinfo);
+    mt->mcu_rows = dinfo->total_iMCU_rows;
+    /* Chunks must start on an MCU row that begins a restart segment. */
+    for (a = ri, b = mt->mcus_per_row; b != 0;) {
+        int t = a % b;
+
+        a = b, b = t;
+    }
+    unit = ri / a;
+    chunk_bytes = (long)unit * mt->mcu_height * mt->scan_line_size;
+    units = (chunk_bytes >= DCTD_MT_CHUNK_BYTES ? 1 :
+             (int)(DCTD_MT_CHUNK_BYTES / chunk_bytes));
+    if (units > mt->mcu_rows / unit)
+        units = mt->mcu_rows / unit;
+    if (units < 1)
+        goto no;
+    mt->chunk_mcu_rows = unit * units;
+    mt->nchunks = (mt->mcu_rows + mt->chunk_mcu_rows - 1) / mt->chunk_mcu_rows;
+    if (mt->nchunks < 2)
+        goto no;
+    /* The chunk allocators need a thread-safe base allocator. */
+    gs_memory_status(mt->memory->thread_safe_memory, &mem_status);
+    if (!mem_status.is_thread_safe)
+        goto no;
+    mt->jpeg_color_space = dinfo->jpeg_color_space;
+    mt->out_color_space = dinfo->out_color_space;
+    mt->end_marker = -1;
+    mt->valid = true;
+    if (dctd_mt_add_seg(mt, 0) < 0)
+        goto no;
+    return 1;
+no:
+    dctd_mt_free(jddp);
+    return 0;
+}
+
+/*
+ * Buffer the entropy-coded data up to the marker that ends the scan.
+ * Return 1 when done, 0 if more input is needed.
+ */
+static int
+dctd_mt_gather(stream_DCT_state *ss, stream_cursor_read *pr, bool last)
+{
+    dctd_mt_state_t *mt = ss->data.decompress->mt;
+    const byte *p = pr->ptr + 1, *end = pr->limit + 1, *q = p;
+    int code;
+
+    while (q < end) {
+        int c;
+
+        if (!mt->after_ff) {
+            q = memchr(q, 0xFF, end - q);
+            if (q == 0) {
+                q = end;
+                break;
+            }
+            q++;
+            mt->after_ff = true;
+            continue;
+        }
+        c = *q++;
+        if (c == 0xFF)
+            continue;		/* fill byte */
+        mt->after_ff = false;
+        if (c == 0)
+            continue;		/* stuffed zero */
+        if (c >= JPEG_RST0 && c <= JPEG_RST0 + 7) {
+            if (c != JPEG_RST0 + ((mt->nseg - 1) & 7))
+                mt->valid = false;
+            if ((code = dctd_mt_add_seg(mt, mt->data_size + (q - p))) < 0)
+                return code;
+            continue;
+        }
+        mt->end_marker = c;
+        break;
+    }
+    code = dctd_mt_append(mt->memory, &mt->data, &mt->data_size,
+                          &mt->data_max, p, q - p);
+    if (code < 0)
+        return code;
+    pr->ptr = q - 1;
+    if (mt->end_marker < 0 && !last)
+        return 0;
+    if (mt->end_marker != JPEG_EOI)
+        mt->valid = false;
+    return dctd_mt_add_seg(mt, mt->data_size) < 0 ? gs_error_VMerror : 1;
+}
+
+/* Synthetic input for a worker. */
+static boolean
+dctd_mt_fill_input_buffer(j_decompress_ptr dinfo)
+{
+    dctd_mt_slot_t *slot = (dctd_mt_slot_t *)
+        ((char *)dinfo - offset_of(dctd_mt_slot_t, jd.dinfo));
+    const dctd_mt_state_t *mt = slot->mt;
+    struct jpeg_source_mgr *src = dinfo->src;
+    const byte *next;
+    ulong size;
+
+    do {
+        int piece = slot->piece++;
+
+        if (piece == 0)
+            next = mt->header, size = mt->sof_height;
+        else if (piece == 1)
+            next = slot->height, size = 2;
+        else if (piece == 2) {
+            next = mt->header + mt->sof_height + 2;
+            size = mt->header_size - mt->sof_height - 2;
+        } else {
+            int seg = (piece - 3) >> 1;
+
+            if (seg >= slot->nsegs) {
+                WARNMS(dinfo, JWRN_JPEG_EOF);
+                next = fake_eoi, size = 2;
+            } else if (piece & 1) {
+                seg += slot->first_seg;
+                next = mt->data + mt->seg[seg];
+                size = mt->seg[seg + 1] - 2 - mt->seg[seg];
+            } else if (seg == slot->nsegs - 1)
+                next = fake_eoi, size = 2;
+            else {
+                slot->marker[0] = 0xFF;
+                slot->marker[1] = JPEG_RST0 + (seg & 7);
+                next = slot->marker, size = 2;
+            }
+        }
+    } while (size == 0);
+    src->next_input_byte = next;
+    src->bytes_in_buffer = size;
+    return TRUE;
+}
+static void
+dctd_mt_skip_input_data(j_decompress_ptr dinfo, long num_bytes)
+{
+    struct jpeg_source_mgr *src = dinfo->src;
+
+    if (num_bytes > 0) {
+        while (num_bytes > (long)src->bytes_in_buffer) {
+            num_bytes -= (long)src->bytes_in_buffer;
+            dctd_mt_fill_input_buffer(dinfo);
+        }
+        src->next_input_byte += num_bytes;
+        src->bytes_in_buffer -= num_bytes;
+    }
+}
+
+/* Decode one chunk.  This runs in a worker thread. */
+static void
+dctd_mt_decode(void *arg)
+{
+    dctd_mt_slot_t *slot = (dctd_mt_slot_t *)arg;
+    const dctd_mt_state_t *mt = slot->mt;
+    stream_DCT_state *st = &slot->st;
+    j_decompress_ptr dinfo = &slot->jd.dinfo;
+    int code, i;
+
+    slot->piece = 0;
+    slot->jd.source.bytes_in_buffer = 0;
+    slot->height[0] = (byte)(slot->nrows >> 8);
+    slot->height[1] = (byte)slot->nrows;
+    code = gs_jpeg_read_header(st, TRUE);
+    if (code != JPEG_HEADER_OK)
+        goto fail;
+    dinfo->jpeg_color_space = mt->jpeg_color_space;
+    dinfo->out_color_space = mt->out_color_space;
+    if ((code = gs_jpeg_start_decompress(st)) <= 0)
+        goto fail;
+    if (dinfo->output_width * dinfo->output_components != mt->scan_line_size ||
+        dinfo->output_height != slot->nrows)
+        goto fail;
+    for (i = 0; i < slot->nrows;) {
+        JSAMPROW row = slot->rows + (ulong)i * mt->scan_line_size;
+
+        if ((code = gs_jpeg_read_scanlines(st, &row, 1)) <= 0)
+            goto fail;
+        i += code;
+    }
+    if ((code = gs_jpeg_finish_decompress(st)) <= 0)
+        goto fail;
+    slot->code = 0;
+    return;
+fail:
+    slot->code = (code < 0 ? code : gs_error_ioerror);
+}
+
+/* Set up the worker decompressors. */
+static int
+dctd_mt_setup(stream_DCT_state *ss)
+{
+    jpeg_decompress_data *jddp = ss->data.decompress;
+    dctd_mt_state_t *mt = jddp->mt;
+    int n = min(mt->nthreads, mt->nchunks), i, j, code;
+    ulong rows_size = (ulong)mt->chunk_mcu_rows * mt->mcu_height *
+                      mt->scan_line_size;
+
+    mt->slots = (dctd_mt_slot_t *)gs_alloc_byte_array(mt->memory, n,
+                            sizeof(dctd_mt_slot_t), "dctd_mt_setup");
+    if (mt->slots == 0)
+        return_error(gs_error_VMerror);
+    memset(mt->slots, 0, n * sizeof(dctd_mt_slot_t));
+    mt->nslots = n;
+    for (i = 0; i < n; i++) {
+        dctd_mt_slot_t *slot = &mt->slots[i];
+        struct jpeg_source_mgr *src = &slot->jd.source;
+
+        slot->mt = mt;
+        if ((code = gs_memory_chunk_wrap(&slot->memory,
+                                         mt->memory->thread_safe_memory)) < 0)
+            return code;
+        slot->rows = gs_alloc_bytes(mt->memory, rows_size, "dctd_mt_setup");
+        if (slot->rows == 0)
+            return_error(gs_error_VMerror);
+        slot->st.memory = slot->memory;
+        slot->st.report_error = s_no_report_error;
+        slot->st.jpeg_memory = slot->memory;
+        slot->st.data.decompress = &slot->jd;
+        slot->jd.memory = slot->memory;
+        if ((code = gs_jpeg_create_decompress(&slot->st)) < 0)
+            return code;
+        slot->created = true;
+        slot->jd.Picky = jddp->Picky;
+        slot->jd.Relax = jddp->Relax;
+        src->init_source = dctd_init_source;
+        src->fill_input_buffer = dctd_mt_fill_input_buffer;
+        src->skip_input_data = dctd_mt_skip_input_data;
+        src->term_source = dctd_term_source;
+        src->resync_to_restart = jpeg_resync_to_restart;
+        slot->jd.dinfo.src = src;
+        /* Tables supplied as parameters apply to every chunk. */
+        for (j = 0; j < NUM_QUANT_TBLS; j++)
+            if (jddp->dinfo.quant_tbl_ptrs[j] != 0) {
+                JQUANT_TBL *t = gs_jpeg_alloc_quant_table(&slot->st);
+
+                if (t == 0)
+                    return_error(gs_error_VMerror);
+                *t = *jddp->dinfo.quant_tbl_ptrs[j];
+                slot->jd.dinfo.quant_tbl_ptrs[j] = t;
+            }
+        for (j = 0; j < NUM_HUFF_TBLS; j++) {
+            if (jddp->dinfo.dc_huff_tbl_ptrs[j] != 0) {
+                JHUFF_TBL *t = gs_jpeg_alloc_huff_table(&slot->st);
+
+                if (t == 0)
+                    return_error(gs_error_VMerror);
+                *t = *jddp->dinfo.dc_huff_tbl_ptrs[j];
+                slot->jd.dinfo.dc_huff_tbl_ptrs[j] = t;
+            }
+            if (jddp->dinfo.ac_huff_tbl_ptrs[j] != 0) {
+                JHUFF_TBL *t = gs_jpeg_alloc_huff_table(&slot->st);
+
+                if (t == 0)
+                    return_error(gs_error_VMerror);
+                *t = *jddp->dinfo.ac_huff_tbl_ptrs[j];
+                slot->jd.dinfo.ac_huff_tbl_ptrs[j] = t;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Decode the next wave of chunks, one per slot. */
+static void
+dctd_mt_wave(stream_DCT_state *ss)
+{
+    dctd_mt_state_t *mt = ss->data.decompress->mt;
+    j_decompress_ptr dinfo = &ss->data.decompress->dinfo;
+    int n = min(mt->nslots, mt->nchunks - mt->next_chunk), i;
+    long total_mcus = (long)mt->mcus_per_row * mt->mcu_rows;
+    int ri = dinfo->restart_interval;
+
+    for (i = 0; i < n; i++) {
+        dctd_mt_slot_t *slot = &mt->slots[i];
+        int r0 = (mt->next_chunk + i) * mt->chunk_mcu_rows;
+        int r1 = min(r0 + mt->chunk_mcu_rows, mt->mcu_rows);
+        int first_seg = (int)((long)r0 * mt->mcus_per_row / ri);
+        int end_seg = (r1 == mt->mcu_rows ?
+                       (int)((total_mcus + ri - 1) / ri) :
+                       (int)((long)r1 * mt->mcus_per_row / ri));
+
+        slot->first_row = r0 * mt->mcu_height;
+        slot->nrows = min(r1 * mt->mcu_height, (int)dinfo->image_height) -
+                      slot->first_row;
+        slot->first_seg = first_seg;
+        slot->nsegs = end_seg - first_seg;
+        slot->thread = 0;
+        if (i > 0 &&
+            gp_thread_start(dctd_mt_decode, slot, &slot->thread) < 0)
+            slot->thread = 0;
+    }
+    dctd_mt_decode(&mt->slots[0]);
+    for (i = 1; i < n; i++) {
+        dctd_mt_slot_t *slot = &mt->slots[i];
+
+        if (slot->thread != 0)
+            gp_thread_finish(slot->thread);
+        else
+            dctd_mt_decode(slot);
+    }
+    mt->next_chunk += n;
+    for (i = 0; i < n && mt->slots[i].code >= 0; i++)
+        DO_NOTHING;
+    mt->wave_slots = i;
+    if (i < n)
+        mt->next_chunk = mt->nchunks;	/* the rest is done sequentially */
+    mt->emit_slot = mt->emit_row = 0;
+}
+
+/* Switch to decoding the buffered data with the main decompressor. */
+static int
+dctd_mt_start_sequential(stream_DCT_state *ss)
+{
+    jpeg_decompress_data *jddp = ss->data.decompress;
+    dctd_mt_state_t *mt = jddp->mt;
+    struct jpeg_source_mgr *src = jddp->dinfo.src;
+    int code, i;
+
+    mt->sequential = true;
+    mt->seq_row = gs_alloc_bytes(mt->memory, mt->scan_line_size,
+                                 "dctd_mt_start_sequential");
+    if (mt->seq_row == 0)
+        return_error(gs_error_VMerror);
+    src->next_input_byte = mt->data;
+    src->bytes_in_buffer = mt->data_size;
+    jddp->input_eod = true;
+    if ((code = gs_jpeg_start_decompress(ss)) <= 0)
+        return (code < 0 ? code : gs_note_error(gs_error_ioerror));
+    /* Skip the rows that the workers have already delivered. */
+    for (i = 0; i < mt->rows_done;) {
+        JSAMPROW row = mt->seq_row;
+
+        if ((code = gs_jpeg_read_scanlines(ss, &row, 1)) <= 0)
+            return (code < 0 ? code : gs_note_error(gs_error_ioerror));
+        i += code;
+    }
+    return 0;
+}
+
+/* Make the next row available in mt->row. */
+static int
+dctd_mt_next_row(stream_DCT_state *ss)
+{
+    dctd_mt_state_t *mt = ss->data.decompress->mt;
+    int code;
+
+    while (!mt->sequential) {
+        if (mt->emit_slot < mt->wave_slots) {
+            dctd_mt_slot_t *slot = &mt->slots[mt->emit_slot];
+
+            mt->row = slot->rows + (ulong)mt->emit_row * mt->scan_line_size;
+            if (++mt->emit_row == slot->nrows)
+                mt->emit_slot++, mt->emit_row = 0;
+            goto done;
+        }
+        if (mt->valid && mt->next_chunk < mt->nchunks)
+            dctd_mt_wave(ss);
+        else if ((code = dctd_mt_start_sequential(ss)) < 0)
+            return code;
+    }
+    {
+        JSAMPROW row = mt->seq_row;
+
+        if ((code = gs_jpeg_read_scanlines(ss, &row, 1)) <= 0)
+            return (code < 0 ? code : gs_note_error(gs_error_ioerror));
+        mt->row = mt->seq_row;
+    }
+done:
+    mt->row_left = mt->scan_line_size;
+    mt->rows_done++;
+    return 0;
+}
+
+/* Process a buffer once the header has been read (phases 6 and 7). */
+static int
+dctd_mt_process(stream_DCT_state *ss, stream_cursor_read *pr,
+                stream_cursor_write *pw, bool last)
+{
+    jpeg_decompress_data *jddp = ss->data.decompress;
+    dctd_mt_state_t *mt = jddp->mt;
+    int code;
+
+    if (ss->phase == 6) {	/* buffering the scan */
+        code = dctd_mt_gather(ss, pr, last);
+        if (code <= 0)
+            return (code < 0 ? ERRC : 0);
+        /* If the workers can't be set up, decode sequentially. */
+        if (mt->valid && dctd_mt_setup(ss) < 0)
+            mt->valid = false;
+        ss->scan_line_size = mt->scan_line_size;
+        ss->phase = 7;
+    }
+    /* Phase 7: delivering rows. */
+    for (;;) {
+        if (mt->row_left != 0) {
+            uint tomove = min(mt->row_left, (uint)(pw->limit - pw->ptr));
+
+            memcpy(pw->ptr + 1, mt->row + (mt->scan_line_size - mt->row_left),
+                   tomove);
+            pw->ptr += tomove;
+            mt->row_left -= tomove;
+            if (mt->row_left != 0)
+                return 1;	/* need more room */
+        }
+        if (mt->rows_done == jddp->dinfo.output_height)
+            break;
+        /* As in phase 3, only oversize scan lines are split. */
+        if (mt->scan_line_size <= (uint) jddp->templat.min_out_size &&
+            (uint) (pw->limit - pw->ptr) < mt->scan_line_size)
+            return 1;	/* need more room */
+        if (dctd_mt_next_row(ss) < 0)
+            return ERRC;
+    }
+    if (mt->sequential && gs_jpeg_finish_decompress(ss) < 0)
+        return ERRC;
+    dctd_mt_free(jddp);
+    ss->phase = 5;
+    return EOFC;
+}
+
 /* Set the defaults for the DCTDecode filter. */
 static void
 s_DCTD_set_defaults(stream_state * st)
@@ -99,6 +734,20 @@ s_DCTD_init(stream_state * st)
     ss->data.decompress->skip = 0;
     ss->data.decompress->input_eod = false;
     ss->data.decompress->faked_eoi = false;
+    ss->data.decompress->mt = 0;
+    if (ss->DecodeThreads > 1 && gp_get_cpu_count() > 1) {
+        /* Keep the header in case the image can be decoded in parallel. */
+        gs_memory_t *mem = ss->jpeg_memory->non_gc_memory;
+        dctd_mt_state_t *mt = (dctd_mt_state_t *)
+            gs_alloc_bytes(mem, sizeof(dctd_mt_state_t), "s_DCTD_init");
+
+        if (mt != 0) {
+            memset(mt, 0, sizeof(*mt));
+            mt->memory = mem;
+            mt->nthreads = min(ss->DecodeThreads, gp_get_cpu_count());
+            ss->data.decompress->mt = mt;
+        }
+    }
     ss->phase = 0;
     return 0;
 }
@@ -149,9 +798,14 @@ s_DCTD_process(stream_state * st, stream_cursor_read * pr,
 
     if_debug3('w', "[wdd]process avail=%u, skip=%u, last=%d\n",
               (uint) (pr->limit - pr->ptr), (uint) jddp->skip, last);
+    if (ss->phase >= 6)
+        return dctd_mt_process(ss, pr, pw, last);
     if (jddp->skip != 0) {
         long avail = pr->limit - pr->ptr;
 
+        if (jddp->mt != 0 &&
+            dctd_mt_record(jddp, pr->ptr + 1, min(avail, jddp->skip)) < 0)
+            return ERRC;
         if (avail < jddp->skip) {
             jddp->skip -= avail;
             pr->ptr = pr->limit;
@@ -181,10 +835,17 @@ s_DCTD_process(stream_state * st, stream_cursor_read * pr,
             ss->phase = 1;
             /* falls through */
         case 1:		/* reading header markers */
-            if ((code = gs_jpeg_read_header(ss, TRUE)) < 0)
-                return ERRC;
-            pr->ptr =
-                (jddp->faked_eoi ? pr->limit : src->next_input_byte - 1);
+            {
+                const byte *start = pr->ptr;
+
+                if ((code = gs_jpeg_read_header(ss, TRUE)) < 0)
+                    return ERRC;
+                pr->ptr =
+                    (jddp->faked_eoi ? pr->limit : src->next_input_byte - 1);
+                if (jddp->mt != 0 &&
+                    dctd_mt_record(jddp, start + 1, pr->ptr - start) < 0)
+                    return ERRC;
+            }
             switch (code) {
                 case JPEG_SUSPENDED:
                     return 0;
@@ -208,6 +869,14 @@ s_DCTD_process(stream_state * st, stream_cursor_read * pr,
                         break;
                 }
             }
+            if (jddp->mt != 0) {
+                if ((code = dctd_mt_begin(ss)) < 0)
+                    return ERRC;
+                if (code > 0) {
+                    ss->phase = 6;
+                    return dctd_mt_process(ss, pr, pw, last);
+                }
+            }
             ss->phase = 2;
             /* falls through */
         case 2:		/* start_decompress */
@@ -321,6 +990,7 @@ s_DCTD_release(stream_state * st)
 {
     stream_DCT_state *const ss = (stream_DCT_state *) st;
 
+    dctd_mt_free(ss->data.decompress);
     gs_jpeg_destroy(ss);
     if (ss->data.decompress->scanline_buffer != NULL)
         gs_free_object(gs_memory_stable(ss->data.common->memory),
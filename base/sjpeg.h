@@ -60,6 +60,7 @@ int gs_jpeg_finish_compress(stream_DCT_state * st);
 int gs_jpeg_create_decompress(stream_DCT_state * st);
 int gs_jpeg_read_header(stream_DCT_state * st,
                         boolean require_image);
+int gs_jpeg_calc_output_dimensions(stream_DCT_state * st);
 int gs_jpeg_start_decompress(stream_DCT_state * st);
 int gs_jpeg_read_scanlines(stream_DCT_state * st,
                            JSAMPARRAY scanlines, int max_lines);
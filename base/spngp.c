@@ -19,6 +19,10 @@
 #include "strimpl.h"
 #include "spngpx.h"
 
+#ifdef HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
 /* ------ PNGPredictorEncode/Decode ------ */
 
 private_st_PNGP_state();
@@ -394,6 +398,153 @@ s_PNGPD_process(stream_state * st, stream_cursor_read * pr,
     return status;
 }
 
+/*
+ * Undo the PNG prediction of one row, or of the first count bytes of
+ * one, in place.  'up' is the preceding decoded row (zeros for the first
+ * row) and 'filter' is the algorithm byte that started the row.  This
+ * is used by the Flate decoder, which applies the predictor to whole
+ * rows as it inflates them (see szlibd.c).  Up, and the Sub and Paeth
+ * recurrences for 3 and 4 byte pixels, use SSE2 where available;
+ * Average is no faster that way.
+ */
+#ifdef HAVE_SSE2
+
+/*
+ * Load or store a 3 or 4 byte pixel in the low lane.  These go a byte
+ * at a time: a wider store would overlap the next load and stall it.
+ */
+static inline __m128i
+pngp_load(const byte *p, int bpp)
+{
+    int v = p[0] | (p[1] << 8) | (p[2] << 16);
+
+    if (bpp == 4)
+        v |= p[3] << 24;
+    return _mm_cvtsi32_si128(v);
+}
+static inline void
+pngp_store(byte *p, __m128i x, int bpp)
+{
+    int v = _mm_cvtsi128_si32(x);
+
+    p[0] = (byte)v;
+    p[1] = (byte)(v >> 8);
+    p[2] = (byte)(v >> 16);
+    if (bpp == 4)
+        p[3] = (byte)(v >> 24);
+}
+static inline __m128i
+pngp_abs16(__m128i x)
+{
+    return _mm_max_epi16(x, _mm_sub_epi16(_mm_setzero_si128(), x));
+}
+static inline __m128i
+pngp_select(__m128i mask, __m128i t, __m128i f)
+{
+    return _mm_or_si128(_mm_and_si128(mask, t), _mm_andnot_si128(mask, f));
+}
+
+/* Return the number of bytes done, a multiple of bpp. */
+static uint
+pngp_unpredict_sse2(int filter, byte *row, const byte *up, uint count,
+                    int bpp)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i a = zero, b = zero, c, d = zero;
+    uint i = 0;
+
+    switch (filter) {
+        case 1:		/* Sub */
+            for (; i + bpp <= count; i += bpp) {
+                a = _mm_add_epi8(pngp_load(row + i, bpp), a);
+                pngp_store(row + i, a, bpp);
+            }
+            break;
+        case 4:		/* Paeth, with 16-bit lanes */
+            for (; i + bpp <= count; i += bpp) {
+                __m128i pa, pb, pc, smallest, nearest;
+
+                c = b;
+                b = _mm_unpacklo_epi8(pngp_load(up + i, bpp), zero);
+                a = d;
+                d = _mm_unpacklo_epi8(pngp_load(row + i, bpp), zero);
+                pa = _mm_sub_epi16(b, c);
+                pb = _mm_sub_epi16(a, c);
+                pc = _mm_add_epi16(pa, pb);
+                pa = pngp_abs16(pa);
+                pb = pngp_abs16(pb);
+                pc = pngp_abs16(pc);
+                smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+                nearest = pngp_select(_mm_cmpeq_epi16(smallest, pa), a,
+                            pngp_select(_mm_cmpeq_epi16(smallest, pb), b, c));
+                d = _mm_add_epi8(d, nearest);
+                pngp_store(row + i, _mm_packus_epi16(d, d), bpp);
+            }
+            break;
+    }
+    return i;
+}
+
+#endif /* HAVE_SSE2 */
+
+void
+s_PNGP_unpredict_row(int filter, byte *row, const byte *up, uint count,
+                     int bpp)
+{
+    uint i = 0;
+
+    switch (filter) {
+        case 0:		/* None */
+            return;
+        case 2:		/* Up */
+#ifdef HAVE_SSE2
+            for (; i + 16 <= count; i += 16)
+                _mm_storeu_si128((__m128i *)(row + i),
+                    _mm_add_epi8(_mm_loadu_si128((const __m128i *)(row + i)),
+                                 _mm_loadu_si128((const __m128i *)(up + i))));
+#endif
+            for (; i < count; ++i)
+                row[i] += up[i];
+            return;
+    }
+    /* Sub, Average and Paeth treat bytes [-bpp .. -1] as zero. */
+#ifdef HAVE_SSE2
+    if (bpp == 3 || bpp == 4)
+        i = pngp_unpredict_sse2(filter, row, up, count, bpp);
+#endif
+    switch (filter) {
+        case 1:		/* Sub */
+            if (i < (uint)bpp)
+                i = bpp;
+            for (; i < count; ++i)
+                row[i] += row[i - bpp];
+            break;
+        case 3:		/* Average */
+            for (; i < count && i < (uint)bpp; ++i)
+                row[i] += up[i] >> 1;
+            if (bpp == 3 && i < count) {
+                /* Keep the left pixel in registers. */
+                uint a0 = row[i - 3], a1 = row[i - 2], a2 = row[i - 1];
+
+                for (; i + 3 <= count; i += 3) {
+                    row[i] = a0 = (byte)(row[i] + ((a0 + up[i]) >> 1));
+                    row[i + 1] = a1 = (byte)(row[i + 1] + ((a1 + up[i + 1]) >> 1));
+                    row[i + 2] = a2 = (byte)(row[i + 2] + ((a2 + up[i + 2]) >> 1));
+                }
+            }
+            for (; i < count; ++i)
+                row[i] += (byte)(((int)row[i - bpp] + (int)up[i]) >> 1);
+            break;
+        case 4:		/* Paeth */
+            for (; i < count && i < (uint)bpp; ++i)
+                row[i] += up[i];
+            for (; i < count; ++i)
+                row[i] += (byte)paeth_predictor(row[i - bpp], up[i],
+                                                up[i - bpp]);
+            break;
+    }
+}
+
 /* Stream templates */
 const stream_template s_PNGPE_template = {
     &st_PNGP_state, s_PNGPE_init, s_PNGPE_process, 1, 1, s_PNGP_release,
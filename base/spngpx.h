@@ -61,4 +61,8 @@ typedef struct stream_PNGP_state_s {
 extern const stream_template s_PNGPD_template;
 extern const stream_template s_PNGPE_template;
 
+/* Undo the prediction of (part of) one row in place. */
+void s_PNGP_unpredict_row(int filter, byte *row, const byte *up,
+                          uint count, int bpp);
+
 #endif /* spngpx_INCLUDED */
@@ -41,6 +41,10 @@ s_zlib_set_defaults(stream_state * st)
     /* DEF_MEM_LEVEL should be in zlib.h or zconf.h, but it isn't. */
     ss->memLevel = min(MAX_MEM_LEVEL, 8);
     ss->strategy = Z_DEFAULT_STRATEGY;
+    ss->Predictor = 1;
+    ss->Colors = 1;
+    ss->BitsPerComponent = 8;
+    ss->Columns = 1;
     /* Clear pointers */
     ss->dynamic = 0;
 }
@@ -60,6 +64,7 @@ s_zlib_alloc_dynamic_state(stream_zlib_state *ss)
         return_error(gs_error_VMerror);
     zds->blocks = 0;
     zds->memory = mem;
+    zds->png_buf = zds->png_prev = 0;
     zds->zstate.zalloc = (alloc_func)s_zlib_alloc;
     zds->zstate.zfree = (free_func)s_zlib_free;
     zds->zstate.opaque = (voidpf)zds;
@@ -18,8 +18,154 @@
 #include "memory_.h"
 #include "std.h"
 #include "strimpl.h"
+#include "spngpx.h"
 #include "szlibxx.h"
 
+/*
+ * If the client sets a PNG Predictor, we undo the prediction here rather
+ * than in a separate PNGPredictorDecode stream.  zlib inflates into a
+ * buffer that holds many rows, which keeps it in its fast loop; each
+ * complete row is then unpredicted in place, using the row before it
+ * as 'up', and copied out.  The result is the same as the two-stage
+ * pipeline, including for a partial last row and a bad algorithm byte.
+ */
+
+/* The row buffer holds at least this many bytes (and at least 1 row). */
+#define ZLIBD_PNG_BUF_SIZE 32768
+
+static int
+s_zlibD_png_init(stream_zlib_state *ss)
+{
+    zlib_dynamic_state_t *zds = ss->dynamic;
+    int bits_per_pixel = ss->Colors * ss->BitsPerComponent;
+    long bits_per_row = (long)bits_per_pixel * ss->Columns;
+    uint row_count;
+
+#if arch_sizeof_long > arch_sizeof_int
+    if (bits_per_row > max_uint * 7L)
+        return ERRC;	/****** WRONG ******/
+#endif
+    row_count = (uint) ((bits_per_row + 7) >> 3);
+    if (ss->Colors > s_PNG_max_Colors || row_count >= max_uint / 2)
+        return ERRC;
+    zds->png_bpp = (bits_per_pixel + 7) >> 3;
+    zds->png_stride = row_count + 1;
+    zds->png_size = max(ZLIBD_PNG_BUF_SIZE / zds->png_stride, 1) *
+        zds->png_stride;
+    zds->png_buf = s_zlib_alloc(zds, zds->png_size, 1);
+    zds->png_prev = s_zlib_alloc(zds, row_count, 1);
+    if (zds->png_buf == 0 || zds->png_prev == 0)
+        return ERRC;	/****** WRONG ******/
+    memset(zds->png_prev, 0, row_count);
+    zds->png_fill = zds->png_done = 0;
+    zds->png_row = zds->png_out = 0;
+    zds->png_status = 0;
+    return 0;
+}
+
+/* Unpredict the complete rows that have been inflated.  At the end of */
+/* the data, also unpredict a trailing partial row. */
+static void
+s_zlibD_png_rows(zlib_dynamic_state_t *zds, bool at_end)
+{
+    uint stride = zds->png_stride;
+    byte *buf = zds->png_buf;
+
+    while (zds->png_done + 1 < zds->png_fill) {
+        uint done = zds->png_done;
+        uint count = min(zds->png_fill - done, stride) - 1;
+        int filter = buf[done];
+
+        if (count < stride - 1 && !at_end)
+            break;
+        if (filter > 4) {
+            zds->png_status = ERRC;
+            break;
+        }
+        s_PNGP_unpredict_row(filter, buf + done + 1,
+                             (done == 0 ? zds->png_prev :
+                              buf + done - stride + 1),
+                             count, zds->png_bpp);
+        zds->png_done = done + 1 + count;
+    }
+}
+
+/* Process a buffer, with a predictor. */
+static int
+s_zlibD_png_process(stream_zlib_state *ss, stream_cursor_read * pr,
+                    stream_cursor_write * pw, bool last)
+{
+    zlib_dynamic_state_t *zds = ss->dynamic;
+    z_stream *zs = &zds->zstate;
+    uint stride = zds->png_stride;
+    byte *buf = zds->png_buf;
+
+    for (;;) {
+        int status;
+
+        /* Copy out rows that are ready. */
+        while (zds->png_out < zds->png_done) {
+            uint end = min(zds->png_row + stride, zds->png_done);
+            uint count;
+
+            if (zds->png_out == zds->png_row)
+                zds->png_out++;		/* skip the algorithm byte */
+            count = min(end - zds->png_out, (uint)(pw->limit - pw->ptr));
+            memcpy(pw->ptr + 1, buf + zds->png_out, count);
+            pw->ptr += count;
+            zds->png_out += count;
+            if (zds->png_out == zds->png_row + stride)
+                zds->png_row += stride;
+            if (zds->png_out < end)
+                return 1;		/* output full */
+        }
+        if (zds->png_status != 0)
+            return zds->png_status;
+        /* Keep the last row, and any partial row, for the next load. */
+        if (zds->png_done != 0) {
+            memcpy(zds->png_prev, buf + zds->png_done - stride + 1,
+                   stride - 1);
+            memmove(buf, buf + zds->png_done,
+                    zds->png_fill - zds->png_done);
+            zds->png_fill -= zds->png_done;
+            zds->png_done = zds->png_row = zds->png_out = 0;
+        }
+        if (pr->ptr == pr->limit) {
+            if (!last)
+                return 0;
+            /* The input ended before the zlib data did. */
+            zds->png_status = EOFC;
+            s_zlibD_png_rows(zds, true);
+            continue;
+        }
+        zs->next_in = (Bytef *)pr->ptr + 1;
+        zs->avail_in = pr->limit - pr->ptr;
+        zs->next_out = buf + zds->png_fill;
+        zs->avail_out = zds->png_size - zds->png_fill;
+        status = inflate(zs, Z_PARTIAL_FLUSH);
+        pr->ptr = zs->next_in - 1;
+        zds->png_fill = zs->next_out - buf;
+        switch (status) {
+            case Z_OK:
+                s_zlibD_png_rows(zds, false);
+                continue;
+            case Z_STREAM_END:
+                zds->png_status = EOFC;
+                break;
+            default:
+                if (!strcmp("incorrect data check", zs->msg)) {
+                    /* See s_zlibD_process. */
+                    errprintf(ss->memory,
+                              "warning: ignoring zlib error: %s\n", zs->msg);
+                    zds->png_status = EOFC;
+                } else
+                    zds->png_status = ERRC;
+        }
+        /* Only a clean end flushes a partial last row. */
+        s_zlibD_png_rows(zds, zds->png_status == EOFC);
+    }
+}
+
 /* Initialize the filter. */
 static int
 s_zlibD_init(stream_state * st)
@@ -36,6 +182,8 @@ s_zlibD_init(stream_state * st)
         s_zlib_free_dynamic_state(ss);
         return ERRC;    /****** WRONG ******/
     }
+    if (ss->Predictor >= 10 && s_zlibD_png_init(ss) < 0)
+        return ERRC;    /****** WRONG ******/
     st->min_left=1;
     return 0;
 }
@@ -45,9 +193,16 @@ static int
 s_zlibD_reset(stream_state * st)
 {
     stream_zlib_state *const ss = (stream_zlib_state *)st;
+    zlib_dynamic_state_t *zds = ss->dynamic;
 
-    if (inflateReset(&ss->dynamic->zstate) != Z_OK)
+    if (inflateReset(&zds->zstate) != Z_OK)
         return ERRC;    /****** WRONG ******/
+    if (zds->png_buf != 0) {
+        memset(zds->png_prev, 0, zds->png_stride - 1);
+        zds->png_fill = zds->png_done = 0;
+        zds->png_row = zds->png_out = 0;
+        zds->png_status = 0;
+    }
     return 0;
 }
 
@@ -62,6 +217,10 @@ s_zlibD_process(stream_state * st, stream_cursor_read * pr,
     int status;
     static const unsigned char jaws_empty[] = {0x58, 0x85, 1, 0, 0, 0, 0, 0, 1, 0x0A};
 
+    if (ss->dynamic->png_buf != 0 &&
+        (zs->total_in != 0 || pr->limit - p < 10 ||
+         memcmp(p + 1, jaws_empty, 10)))
+        return s_zlibD_png_process(ss, pr, pw, ignore_last);
     /* Detect no input or full output so that we don't get */
     /* a Z_BUF_ERROR return. */
     if (pw->ptr == pw->limit)
@@ -109,8 +268,13 @@ s_zlibD_release(stream_state * st)
 {
     stream_zlib_state *const ss = (stream_zlib_state *)st;
 
-    if (ss->dynamic != NULL)
+    if (ss->dynamic != NULL) {
         inflateEnd(&ss->dynamic->zstate);
+        if (ss->dynamic->png_buf != 0)
+            s_zlib_free(ss->dynamic, ss->dynamic->png_buf);
+        if (ss->dynamic->png_prev != 0)
+            s_zlib_free(ss->dynamic, ss->dynamic->png_prev);
+    }
     s_zlib_free_dynamic_state(ss);
 }
 
@@ -33,6 +33,12 @@ typedef struct stream_zlib_state_s {
     int method;
     int memLevel;
     int strategy;
+    /* Parameters - decompression only */
+    int Predictor;		/* PNG predictor (10-15) to undo while */
+                                /* inflating, or 1 for none */
+    int Colors;			/* for Predictor, as for PNGPredictorDecode */
+    int BitsPerComponent;
+    uint Columns;
     /* Dynamic state */
     zlib_dynamic_state_t *dynamic;
 } stream_zlib_state;
@@ -44,6 +44,17 @@ struct zlib_block_s {
     gs_memory_t *memory;
     zlib_block_t *blocks;
     z_stream zstate;
+    /* Rows being unpredicted by the decoder (see szlibd.c). */
+    /* These are allocated with s_zlib_alloc, so they are on blocks. */
+    byte *png_buf;		/* whole rows, each with its algorithm byte */
+    byte *png_prev;		/* last row of the previous buffer load */
+    uint png_stride;		/* bytes per row + 1 */
+    uint png_size;		/* a multiple of png_stride */
+    int png_bpp;
+    uint png_fill;		/* bytes inflated into png_buf */
+    uint png_done;		/* bytes of unpredicted rows */
+    uint png_row, png_out;	/* row being copied out, next byte */
+    int png_status;		/* EOFC or ERRC once the data has ended */
 } /*zlib_dynamic_state_t*/;
 #define private_st_zlib_dynamic_state()	/* in szlibc.c */\
   gs_private_st_ptrs1(st_zlib_dynamic_state, zlib_dynamic_state_t,\
@@ -40,6 +40,27 @@ struct ttfSubGlyphUsage_s {
     short arg1, arg2;
 };
 
+/* An instance state after the font and prep programs ran.
+   Faces of the same font at the same size get it by a copy
+   instead of executing the programs again. The arrays follow
+   the header in the same block, so it holds no pointers. */
+struct ttfInstanceSnapshot_s {
+    unsigned long font_id;
+    F26Dot6 ww, hh;
+    Int fontPgmSize, cvtPgmSize;
+    Int numFDefs, numIDefs, cvtSize, storeSize, n_twilight;
+    unsigned int stamp;
+    TIns_Metrics metrics;
+    TGraphicsState GS;
+    Int countIDefs;
+    Byte IDefPtr[256];
+    TT_F26Dot6 period, phase, threshold;
+    /* Followed with cvt, storage, twilight org_x, org_y, cur_x, cur_y,
+       FDefs, IDefs. */
+};
+
+#define SNAPSHOT_ALIGN(n) (((n) + sizeof(double) - 1) & ~(sizeof(double) - 1))
+
 /*------------------------------------------------------------------- */
 
 static TT_Fixed AVE(F26Dot6 a, F26Dot6 b)
@@ -155,6 +176,8 @@ int ttfInterpreter__obtain(ttfMemory *mem, ttfInterpreter **ptti)
     tti->usage_size = 0;
     tti->ttf_memory = mem;
     tti->lock = 1;
+    memset(tti->snapshot, 0, sizeof(tti->snapshot));
+    tti->snapshot_stamp = 0;
     tti->exec = mem->alloc_struct(mem, (const ttfMemoryDescriptor *)&st_TExecution_Context, "ttfInterpreter__obtain");
     if (!tti->exec) {
         mem->free(mem, tti, "ttfInterpreter__obtain");
@@ -169,9 +192,12 @@ void ttfInterpreter__release(ttfInterpreter **ptti)
 {
     ttfInterpreter *tti = *ptti;
     ttfMemory *mem = tti->ttf_memory;
+    int i;
 
     if(--tti->lock)
         return;
+    for (i = 0; i < TTF_INSTANCE_CACHE_SIZE; i++)
+        mem->free(mem, tti->snapshot[i], "ttfInterpreter__release");
     mem->free(mem, tti->usage, "ttfInterpreter__release");
     mem->free(mem, tti->exec, "ttfInterpreter__release");
     mem->free(mem, *ptti, "ttfInterpreter__release");
@@ -214,6 +240,148 @@ void ttfFont__finit(ttfFont *self)
     self->face = NULL;
 }
 
+/*-------------------------------------------------------------------*/
+
+static int ttfFont__snapshot_size(TInstance *ins, int n_twilight)
+{
+    return SNAPSHOT_ALIGN(sizeof(ttfInstanceSnapshot)) +
+           SNAPSHOT_ALIGN(sizeof(Long) * ins->cvtSize) +
+           SNAPSHOT_ALIGN(sizeof(Long) * ins->storeSize) +
+           SNAPSHOT_ALIGN(sizeof(TT_F26Dot6) * n_twilight) * 4 +
+           SNAPSHOT_ALIGN(sizeof(TDefRecord) * ins->numFDefs) +
+           SNAPSHOT_ALIGN(sizeof(TDefRecord) * ins->numIDefs);
+}
+
+/* Copy the instance arrays and the twilight zone to or from a snapshot. */
+static void ttfFont__snapshot_copy(ttfInstanceSnapshot *snap, TInstance *ins,
+                                   TExecution_Context *exec, bool save)
+{
+    byte *p = (byte *)snap + SNAPSHOT_ALIGN(sizeof(ttfInstanceSnapshot));
+    int n = snap->n_twilight;
+    struct {
+        void *data;
+        int size;
+    } a[8];
+    int i;
+
+    a[0].data = ins->cvt;           a[0].size = sizeof(Long) * ins->cvtSize;
+    a[1].data = ins->storage;       a[1].size = sizeof(Long) * ins->storeSize;
+    a[2].data = exec->twilight.org_x; a[2].size = sizeof(TT_F26Dot6) * n;
+    a[3].data = exec->twilight.org_y; a[3].size = sizeof(TT_F26Dot6) * n;
+    a[4].data = exec->twilight.cur_x; a[4].size = sizeof(TT_F26Dot6) * n;
+    a[5].data = exec->twilight.cur_y; a[5].size = sizeof(TT_F26Dot6) * n;
+    a[6].data = ins->FDefs;         a[6].size = sizeof(TDefRecord) * ins->numFDefs;
+    a[7].data = ins->IDefs;         a[7].size = sizeof(TDefRecord) * ins->numIDefs;
+    for (i = 0; i < (int)countof(a); i++) {
+        if (a[i].size > 0) {
+            if (save)
+                memcpy(p, a[i].data, a[i].size);
+            else
+                memcpy(a[i].data, p, a[i].size);
+        }
+        p += SNAPSHOT_ALIGN(a[i].size);
+    }
+}
+
+static ttfInstanceSnapshot *ttfFont__find_snapshot(ttfFont *self, F26Dot6 ww, F26Dot6 hh)
+{
+    ttfInterpreter *tti = self->tti;
+    TInstance *ins = self->inst;
+    TFace *face = self->face;
+    int i;
+
+    if (self->font_id == 0)
+        return NULL;
+    for (i = 0; i < TTF_INSTANCE_CACHE_SIZE; i++) {
+        ttfInstanceSnapshot *snap = tti->snapshot[i];
+
+        if (snap != NULL && snap->font_id == self->font_id &&
+                snap->ww == ww && snap->hh == hh &&
+                snap->fontPgmSize == face->fontPgmSize &&
+                snap->cvtPgmSize == face->cvtPgmSize &&
+                snap->numFDefs == ins->numFDefs &&
+                snap->numIDefs == ins->numIDefs &&
+                snap->cvtSize == ins->cvtSize &&
+                snap->storeSize == ins->storeSize &&
+                snap->n_twilight == self->exec->twilight.n_points) {
+            snap->stamp = ++tti->snapshot_stamp;
+            return snap;
+        }
+    }
+    return NULL;
+}
+
+/* Set up the instance from a snapshot, as if Instance_Init and
+   TT_Set_Instance_CharSizes were called. */
+static void ttfFont__restore_snapshot(ttfFont *self, ttfInstanceSnapshot *snap)
+{
+    TInstance *ins = self->inst;
+    TFace *face = self->face;
+    TExecution_Context *exec = self->exec;
+
+    ttfFont__snapshot_copy(snap, ins, exec, false);
+    ins->metrics = snap->metrics;
+    ins->GS = snap->GS;
+    ins->countIDefs = snap->countIDefs;
+    memcpy(ins->IDefPtr, snap->IDefPtr, sizeof(ins->IDefPtr));
+    ins->codeRangeTable[TT_CodeRange_Font - 1].Base = face->fontProgram;
+    ins->codeRangeTable[TT_CodeRange_Font - 1].Size = face->fontPgmSize;
+    ins->codeRangeTable[TT_CodeRange_Cvt - 1].Base = face->cvtProgram;
+    ins->codeRangeTable[TT_CodeRange_Cvt - 1].Size = face->cvtPgmSize;
+    ins->valid = TRUE;
+    exec->period = snap->period;
+    exec->phase = snap->phase;
+    exec->threshold = snap->threshold;
+}
+
+/* Save the instance state for other faces of the font.
+   Failures are ignored : the programs will just run again. */
+static void ttfFont__save_snapshot(ttfFont *self, F26Dot6 ww, F26Dot6 hh)
+{
+    ttfInterpreter *tti = self->tti;
+    ttfMemory *mem = tti->ttf_memory;
+    TInstance *ins = self->inst;
+    TExecution_Context *exec = self->exec;
+    ttfInstanceSnapshot *snap;
+    int i, j = 0, n_twilight = exec->twilight.n_points;
+
+    if (self->font_id == 0)
+        return;
+    snap = mem->alloc_bytes(mem, ttfFont__snapshot_size(ins, n_twilight), "ttfFont__save_snapshot");
+    if (snap == NULL)
+        return;
+    /* Replace an empty or the least recently used entry. */
+    for (i = 0; i < TTF_INSTANCE_CACHE_SIZE; i++) {
+        if (tti->snapshot[i] == NULL) {
+            j = i;
+            break;
+        }
+        if (tti->snapshot[i]->stamp < tti->snapshot[j]->stamp)
+            j = i;
+    }
+    mem->free(mem, tti->snapshot[j], "ttfFont__save_snapshot");
+    tti->snapshot[j] = snap;
+    snap->font_id = self->font_id;
+    snap->ww = ww;
+    snap->hh = hh;
+    snap->fontPgmSize = self->face->fontPgmSize;
+    snap->cvtPgmSize = self->face->cvtPgmSize;
+    snap->numFDefs = ins->numFDefs;
+    snap->numIDefs = ins->numIDefs;
+    snap->cvtSize = ins->cvtSize;
+    snap->storeSize = ins->storeSize;
+    snap->n_twilight = n_twilight;
+    snap->stamp = ++tti->snapshot_stamp;
+    snap->metrics = ins->metrics;
+    snap->GS = ins->GS;
+    snap->countIDefs = ins->countIDefs;
+    memcpy(snap->IDefPtr, ins->IDefPtr, sizeof(snap->IDefPtr));
+    snap->period = exec->period;
+    snap->phase = exec->phase;
+    snap->threshold = exec->threshold;
+    ttfFont__snapshot_copy(snap, ins, exec, true);
+}
+
 #define MAX_SUBGLYPH_NESTING 3 /* Arbitrary. We need this because we don't want
                                   a ttfOutliner__BuildGlyphOutline recursion
                                   while a glyph is loaded in ttfReader. */
@@ -229,6 +397,7 @@ FontError ttfFont__Open(ttfInterpreter *tti, ttfFont *self, ttfReader *r,
     TT_Instance I;
     ttfMemory *mem = tti->ttf_memory;
     F26Dot6 ww, hh;
+    ttfInstanceSnapshot *snap;
 
     self->tti = tti;
     self->design_grid = design_grid;
@@ -326,6 +495,18 @@ FontError ttfFont__Open(ttfInterpreter *tti, ttfFont *self, ttfReader *r,
         return fMemoryError;
     if (code)
         return fBadFontData;
+    if (design_grid)
+        ww = hh = shortToF26Dot6(self->nUnitsPerEm);
+    else {
+        /* Round towards zero for a better view of mirrored characters : */
+        ww = floatToF26Dot6(w);
+        hh = floatToF26Dot6(h);
+    }
+    snap = ttfFont__find_snapshot(self, ww, hh);
+    if (snap != NULL) {
+        ttfFont__restore_snapshot(self, snap);
+        return fNoError;
+    }
     for(k = 0; k < self->face->cvtSize; k++)
         self->inst->cvt[k] = shortToF26Dot6(self->face->cvt[k]);
     code = Instance_Init(self->inst);
@@ -336,13 +517,6 @@ FontError ttfFont__Open(ttfInterpreter *tti, ttfFont *self, ttfReader *r,
     else if (code)
         return fBadFontData;
     I.z = self->inst;
-    if (design_grid)
-        ww = hh = shortToF26Dot6(self->nUnitsPerEm);
-    else {
-        /* Round towards zero for a better view of mirrored characters : */
-        ww = floatToF26Dot6(w);
-        hh = floatToF26Dot6(h);
-    }
     code = TT_Set_Instance_CharSizes(I, ww, hh);
     self->inst->metrics  = self->exec->metrics;
     if (code == TT_Err_Invalid_Engine)
@@ -355,6 +529,7 @@ FontError ttfFont__Open(ttfInterpreter *tti, ttfFont *self, ttfReader *r,
         return fBadFontData;
     if (code1)
         return code1;
+    ttfFont__save_snapshot(self, ww, hh);
     return code;
 }
 
@@ -142,6 +142,25 @@ static RELOC_PTRS_WITH(ttfFont_reloc_ptrs, ttfFont *mptr)
     DISCARD(mptr);
 RELOC_PTRS_END
 
-gs_public_st_ptrs3(st_ttfInterpreter, ttfInterpreter, "ttfInterpreter",
-    st_ttfInterpreter_enum_ptrs, st_ttfInterpreter_reloc_ptrs,
-    exec, usage, ttf_memory);
+gs_public_st_composite(st_ttfInterpreter, ttfInterpreter,
+    "ttfInterpreter", ttfInterpreter_enum_ptrs, ttfInterpreter_reloc_ptrs);
+
+static
+ENUM_PTRS_WITH(ttfInterpreter_enum_ptrs, ttfInterpreter *tti)
+    if (index < 3 + TTF_INSTANCE_CACHE_SIZE)
+        ENUM_RETURN(tti->snapshot[index - 3]);
+    return 0;
+ENUM_PTR3(0, ttfInterpreter, exec, usage, ttf_memory);
+ENUM_PTRS_END
+
+static RELOC_PTRS_WITH(ttfInterpreter_reloc_ptrs, ttfInterpreter *mptr)
+{
+    int i;
+
+    RELOC_PTR(ttfInterpreter, exec);
+    RELOC_PTR(ttfInterpreter, usage);
+    RELOC_PTR(ttfInterpreter, ttf_memory);
+    for (i = 0; i < TTF_INSTANCE_CACHE_SIZE; i++)
+        RELOC_VAR(mptr->snapshot[i]);
+}
+RELOC_PTRS_END
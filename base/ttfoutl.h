@@ -74,6 +74,12 @@ struct ttfMemory_s {
 
 typedef struct ttfSubGlyphUsage_s ttfSubGlyphUsage;
 
+/* The instance state left by the font and prep programs,
+   saved for reuse by other faces of the same font at the same size. */
+typedef struct ttfInstanceSnapshot_s ttfInstanceSnapshot;
+
+#define TTF_INSTANCE_CACHE_SIZE 8
+
 /* Define a capsule for the TT interpreter. */
 struct ttfInterpreter_s {
     TExecution_Context *exec;
@@ -82,6 +88,8 @@ struct ttfInterpreter_s {
     int usage_top;
     int lock;
     ttfMemory *ttf_memory;
+    ttfInstanceSnapshot *snapshot[TTF_INSTANCE_CACHE_SIZE];
+    unsigned int snapshot_stamp;
 };
 
 /* Define TT interpreter return codes. */
@@ -146,6 +154,7 @@ struct ttfFont_s {
     unsigned int nIndexToLocFormat;
     bool    patented;
     bool    design_grid;
+    unsigned long font_id; /* Keys the instance cache, 0 disables it. */
     TFace *face;
     TInstance *inst;
     TExecution_Context  *exec;
@@ -4892,6 +4892,88 @@ static int nInstrCount=0;
     ,{"  MIRP[31]  ",  Ins_MIRP       }
   };
 
+/*******************************************************************
+ *
+ *  Function    :  Push_Fast
+ *
+ *  Description :  Executes a PUSHB, PUSHW, NPUSHB or NPUSHW opcode
+ *                 at IP without going through the dispatch table.
+ *                 Pushes make up a large share of the executed
+ *                 opcodes in hinting programs.  Only the well formed
+ *                 case is handled here : if the operands run past the
+ *                 code range or the stack would overflow, the opcode
+ *                 is left to the generic path which reports the error.
+ *
+ *  Output :  TRUE if the opcode was executed.
+ *
+ *****************************************************************/
+
+#ifndef DEBUG
+  static Bool  Push_Fast( EXEC_OP )
+  {
+    Int    L, K, length;
+    PByte  p;
+    PStorage  args;
+
+    CUR.opcode = CUR.code[CUR.IP];
+
+    if ( CUR.opcode >= 0xB0 )
+    {
+      if ( CUR.opcode <= 0xB7 )
+      {
+        L = CUR.opcode - 0xB0 + 1;
+        length = L + 1;
+        if ( CUR.IP + length > CUR.codeSize ||
+             CUR.top + L > CUR.stackSize )
+          return FALSE;
+        p    = CUR.code + CUR.IP + 1;
+        args = CUR.stack + CUR.top;
+        for ( K = 0; K < L; K++ )
+          args[K] = p[K];
+      }
+      else if ( CUR.opcode <= 0xBF )
+      {
+        L = CUR.opcode - 0xB8 + 1;
+        length = L * 2 + 1;
+        if ( CUR.IP + length > CUR.codeSize ||
+             CUR.top + L > CUR.stackSize )
+          return FALSE;
+        p    = CUR.code + CUR.IP + 1;
+        args = CUR.stack + CUR.top;
+        for ( K = 0; K < L; K++, p += 2 )
+          args[K] = (Short)( ( p[0] << 8 ) + p[1] );
+      }
+      else
+        return FALSE;
+    }
+    else if ( CUR.opcode == 0x40 || CUR.opcode == 0x41 )
+    {
+      if ( CUR.IP + 1 >= CUR.codeSize )
+        return FALSE;
+      L = CUR.code[CUR.IP + 1];
+      length = ( CUR.opcode == 0x40 ? L : L * 2 ) + 2;
+      if ( CUR.IP + length > CUR.codeSize ||
+           CUR.top + L > CUR.stackSize )
+        return FALSE;
+      p    = CUR.code + CUR.IP + 2;
+      args = CUR.stack + CUR.top;
+      if ( CUR.opcode == 0x40 )
+        for ( K = 0; K < L; K++ )
+          args[K] = p[K];
+      else
+        for ( K = 0; K < L; K++, p += 2 )
+          args[K] = (Short)( ( p[0] << 8 ) + p[1] );
+    }
+    else
+      return FALSE;
+
+    CUR.length = length;
+    CUR.top   += L;
+    CUR.IP    += length;
+    return TRUE;
+  }
+#endif
+
 /****************************************************************/
 /*                                                              */
 /*                    RUN                                       */
@@ -4981,6 +5063,11 @@ static int nInstrCount=0;
 
     do
     {
+#     ifndef DEBUG
+        if ( Push_Fast( EXEC_ARG ) )
+          goto _LSuiteLabel;
+#     endif
+
       CALC_Length();
 
       /* First, let's check for empty stack and overflow */
@@ -126,6 +126,97 @@ build_ycc_rgb_table (j_decompress_ptr cinfo)
 }
 
 
+#if defined(HAVE_SSE2) && BITS_IN_JSAMPLE == 8 && \
+    RGB_RED == 0 && RGB_GREEN == 1 && RGB_BLUE == 2 && RGB_PIXELSIZE == 3
+
+#include <emmintrin.h>
+
+#define YCC_SSE2_SUPPORTED
+
+/*
+ * SSE2 YCbCr->RGB conversion of 16 pixels, giving exactly the results of
+ * the tables built above.  Writing each constant as an integer multiple of
+ * 2^SCALEBITS plus a 16-bit remainder, the products by the remainders are
+ * done in 16-bit lanes: the high half of the product plus bit 15 of the
+ * low half is the product plus ONE_HALF, shifted right by SCALEBITS.
+ * The two G terms are summed in 32-bit lanes before rounding, as in the
+ * tables.  Range limiting is done by the saturating packs, which is what
+ * range_limit does for the sums that can occur here.
+ */
+
+#define CR_R_REM	(FIX(1.40200) - (1L << SCALEBITS))
+#define CB_B_REM	(FIX(1.77200) - (2L << SCALEBITS))
+#define CR_G_REM	((1L << SCALEBITS) - FIX(0.71414))
+
+LOCAL(void)
+ycc_rgb_sse2 (JSAMPROW inptr0, JSAMPROW inptr1, JSAMPROW inptr2,
+	      __m128i * rgb)
+{
+  __m128i zero = _mm_setzero_si128();
+  __m128i center = _mm_set1_epi16(CENTERJSAMPLE);
+  __m128i y8 = _mm_loadu_si128((const __m128i *) inptr0);
+  __m128i cb8 = _mm_loadu_si128((const __m128i *) inptr1);
+  __m128i cr8 = _mm_loadu_si128((const __m128i *) inptr2);
+  __m128i y, cb, cr, r[2], g[2], b[2], t, glo, ghi;
+  int h;
+
+  for (h = 0; h < 2; h++) {
+    y = h ? _mm_unpackhi_epi8(y8, zero) : _mm_unpacklo_epi8(y8, zero);
+    cb = _mm_sub_epi16(h ? _mm_unpackhi_epi8(cb8, zero)
+		       : _mm_unpacklo_epi8(cb8, zero), center);
+    cr = _mm_sub_epi16(h ? _mm_unpackhi_epi8(cr8, zero)
+		       : _mm_unpacklo_epi8(cr8, zero), center);
+
+    /* R = Y + Cr + (CR_R_REM * Cr + ONE_HALF) >> SCALEBITS */
+    t = _mm_set1_epi16((short) CR_R_REM);
+    r[h] = _mm_add_epi16(_mm_add_epi16(y, cr),
+			 _mm_add_epi16(_mm_mulhi_epi16(cr, t),
+				       _mm_srli_epi16(_mm_mullo_epi16(cr, t), 15)));
+
+    /* B = Y + 2 * Cb + (CB_B_REM * Cb + ONE_HALF) >> SCALEBITS */
+    t = _mm_set1_epi16((short) CB_B_REM);
+    b[h] = _mm_add_epi16(_mm_add_epi16(y, _mm_add_epi16(cb, cb)),
+			 _mm_add_epi16(_mm_mulhi_epi16(cb, t),
+				       _mm_srli_epi16(_mm_mullo_epi16(cb, t), 15)));
+
+    /* G = Y - Cr + (- FIX(0.34414) * Cb + CR_G_REM * Cr + ONE_HALF) >> SCALEBITS */
+    t = _mm_setr_epi16((short) - FIX(0.34414), (short) CR_G_REM,
+		       (short) - FIX(0.34414), (short) CR_G_REM,
+		       (short) - FIX(0.34414), (short) CR_G_REM,
+		       (short) - FIX(0.34414), (short) CR_G_REM);
+    glo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(cb, cr), t),
+				       _mm_set1_epi32(ONE_HALF)), SCALEBITS);
+    ghi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(cb, cr), t),
+				       _mm_set1_epi32(ONE_HALF)), SCALEBITS);
+    g[h] = _mm_add_epi16(_mm_sub_epi16(y, cr), _mm_packs_epi32(glo, ghi));
+  }
+  rgb[0] = _mm_packus_epi16(r[0], r[1]);
+  rgb[1] = _mm_packus_epi16(g[0], g[1]);
+  rgb[2] = _mm_packus_epi16(b[0], b[1]);
+}
+
+/* Store the first three bytes of each of the four 32-bit lanes of px. */
+LOCAL(void)
+store_rgb4_sse2 (JSAMPROW outptr, __m128i px)
+{
+  __m128i mask3 = _mm_setr_epi32(0xffffff, 0, 0xffffff, 0);
+  __m128i mask6 = _mm_setr_epi32(-1, 0xffff, 0, 0);
+  int last;
+
+  /* Close up the gap between the two pixels in each 64-bit half, */
+  px = _mm_or_si128(_mm_and_si128(px, mask3),
+		    _mm_srli_epi64(_mm_andnot_si128(mask3, px), 8));
+  /* then between the halves. */
+  px = _mm_or_si128(_mm_and_si128(px, mask6),
+		    _mm_srli_si128(_mm_andnot_si128(mask6, px), 2));
+  _mm_storel_epi64((__m128i *) outptr, px);
+  last = _mm_cvtsi128_si32(_mm_srli_si128(px, 8));
+  MEMCOPY(outptr + 8, &last, 4);
+}
+
+#endif /* HAVE_SSE2 */
+
+
 /*
  * Convert some rows of samples to the output colorspace.
  *
@@ -162,7 +253,24 @@ ycc_rgb_convert (j_decompress_ptr cinfo,
     inptr2 = input_buf[2][input_row];
     input_row++;
     outptr = *output_buf++;
-    for (col = 0; col < num_cols; col++) {
+    col = 0;
+#ifdef YCC_SSE2_SUPPORTED
+    for (; col + 16 <= num_cols; col += 16) {
+      __m128i rgb[3], rg, bx;
+
+      ycc_rgb_sse2(inptr0 + col, inptr1 + col, inptr2 + col, rgb);
+      rg = _mm_unpacklo_epi8(rgb[0], rgb[1]);
+      bx = _mm_unpacklo_epi8(rgb[2], _mm_setzero_si128());
+      store_rgb4_sse2(outptr, _mm_unpacklo_epi16(rg, bx));
+      store_rgb4_sse2(outptr + 12, _mm_unpackhi_epi16(rg, bx));
+      rg = _mm_unpackhi_epi8(rgb[0], rgb[1]);
+      bx = _mm_unpackhi_epi8(rgb[2], _mm_setzero_si128());
+      store_rgb4_sse2(outptr + 24, _mm_unpacklo_epi16(rg, bx));
+      store_rgb4_sse2(outptr + 36, _mm_unpackhi_epi16(rg, bx));
+      outptr += 16 * RGB_PIXELSIZE;
+    }
+#endif
+    for (; col < num_cols; col++) {
       y  = GETJSAMPLE(inptr0[col]);
       cb = GETJSAMPLE(inptr1[col]);
       cr = GETJSAMPLE(inptr2[col]);
@@ -380,7 +488,30 @@ ycck_cmyk_convert (j_decompress_ptr cinfo,
     inptr3 = input_buf[3][input_row];
     input_row++;
     outptr = *output_buf++;
-    for (col = 0; col < num_cols; col++) {
+    col = 0;
+#ifdef YCC_SSE2_SUPPORTED
+    for (; col + 16 <= num_cols; col += 16) {
+      __m128i rgb[3], k, ones = _mm_set1_epi8(-1);
+      __m128i cm, yk;
+
+      /* MAXJSAMPLE - x is the complement for 8-bit samples. */
+      ycc_rgb_sse2(inptr0 + col, inptr1 + col, inptr2 + col, rgb);
+      rgb[0] = _mm_xor_si128(rgb[0], ones);
+      rgb[1] = _mm_xor_si128(rgb[1], ones);
+      rgb[2] = _mm_xor_si128(rgb[2], ones);
+      k = _mm_loadu_si128((const __m128i *) (inptr3 + col));
+      cm = _mm_unpacklo_epi8(rgb[0], rgb[1]);
+      yk = _mm_unpacklo_epi8(rgb[2], k);
+      _mm_storeu_si128((__m128i *) outptr, _mm_unpacklo_epi16(cm, yk));
+      _mm_storeu_si128((__m128i *) (outptr + 16), _mm_unpackhi_epi16(cm, yk));
+      cm = _mm_unpackhi_epi8(rgb[0], rgb[1]);
+      yk = _mm_unpackhi_epi8(rgb[2], k);
+      _mm_storeu_si128((__m128i *) (outptr + 32), _mm_unpacklo_epi16(cm, yk));
+      _mm_storeu_si128((__m128i *) (outptr + 48), _mm_unpackhi_epi16(cm, yk));
+      outptr += 16 * 4;
+    }
+#endif
+    for (; col < num_cols; col++) {
       y  = GETJSAMPLE(inptr0[col]);
       cb = GETJSAMPLE(inptr1[col]);
       cr = GETJSAMPLE(inptr2[col]);
@@ -225,6 +225,35 @@ int_upsample (j_decompress_ptr cinfo, jpeg_component_info * compptr,
 }
 
 
+#if defined(HAVE_SSE2) && BITS_IN_JSAMPLE == 8
+
+#include <emmintrin.h>
+
+/*
+ * Double each of the input samples of one row, 16 at a time, stopping
+ * where fewer than 32 outputs are left.  Returns the number of outputs
+ * written; the caller does the rest.
+ */
+
+LOCAL(JDIMENSION)
+h2_upsample_sse2 (JSAMPROW inptr, JSAMPROW outptr, JDIMENSION width)
+{
+  JDIMENSION done;
+  __m128i in;
+
+  for (done = 0; done + 32 <= width; done += 32) {
+    in = _mm_loadu_si128((const __m128i *) inptr);
+    _mm_storeu_si128((__m128i *) outptr, _mm_unpacklo_epi8(in, in));
+    _mm_storeu_si128((__m128i *) (outptr + 16), _mm_unpackhi_epi8(in, in));
+    inptr += 16;
+    outptr += 32;
+  }
+  return done;
+}
+
+#endif /* HAVE_SSE2 */
+
+
 /*
  * Fast processing for the common case of 2:1 horizontal and 1:1 vertical.
  * It's still a box filter.
@@ -239,11 +268,19 @@ h2v1_upsample (j_decompress_ptr cinfo, jpeg_component_info * compptr,
   register JSAMPLE invalue;
   JSAMPROW outend;
   int outrow;
+#if defined(HAVE_SSE2) && BITS_IN_JSAMPLE == 8
+  JDIMENSION done;
+#endif
 
   for (outrow = 0; outrow < cinfo->max_v_samp_factor; outrow++) {
     inptr = input_data[outrow];
     outptr = output_data[outrow];
     outend = outptr + cinfo->output_width;
+#if defined(HAVE_SSE2) && BITS_IN_JSAMPLE == 8
+    done = h2_upsample_sse2(inptr, outptr, cinfo->output_width);
+    inptr += done / 2;
+    outptr += done;
+#endif
     while (outptr < outend) {
       invalue = *inptr++;	/* don't need GETJSAMPLE() here */
       *outptr++ = invalue;
@@ -267,12 +304,20 @@ h2v2_upsample (j_decompress_ptr cinfo, jpeg_component_info * compptr,
   register JSAMPLE invalue;
   JSAMPROW outend;
   int inrow, outrow;
+#if defined(HAVE_SSE2) && BITS_IN_JSAMPLE == 8
+  JDIMENSION done;
+#endif
 
   inrow = outrow = 0;
   while (outrow < cinfo->max_v_samp_factor) {
     inptr = input_data[inrow];
     outptr = output_data[outrow];
     outend = outptr + cinfo->output_width;
+#if defined(HAVE_SSE2) && BITS_IN_JSAMPLE == 8
+    done = h2_upsample_sse2(inptr, outptr, cinfo->output_width);
+    inptr += done / 2;
+    outptr += done;
+#endif
     while (outptr < outend) {
       invalue = *inptr++;	/* don't need GETJSAMPLE() here */
       *outptr++ = invalue;
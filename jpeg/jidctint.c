@@ -163,6 +163,249 @@
 #define DEQUANTIZE(coef,quantval)  (((ISLOW_MULT_TYPE) (coef)) * (quantval))
 
 
+#if defined(HAVE_SSE2) && BITS_IN_JSAMPLE == 8
+
+#include <emmintrin.h>
+
+/*
+ * SSE2 version of the 8x8 IDCT below.  Each pass works on all eight
+ * columns (pass 1) or rows (pass 2) at once, with the inputs in 16-bit
+ * lanes and the products and sums in 32-bit lanes.  Each multiply-add
+ * takes a pair of inputs, so the constants are the scalar code's
+ * constants combined pairwise.  The results are the same as the scalar
+ * code as long as the inputs to each pass are less than 2^14 in
+ * magnitude: then the sums of two inputs fit in 16 bits and the outputs,
+ * with a kernel gain under 2^16, fit in 32 bits.  Valid data is always
+ * well inside that.  If a block is not, we return FALSE and the caller
+ * uses the scalar code.
+ */
+
+/* A pair of 16-bit constants for _mm_madd_epi16. */
+#define PAIR_SSE2(c0,c1) \
+  _mm_setr_epi16((short) (c0), (short) (c1), (short) (c0), (short) (c1), \
+		 (short) (c0), (short) (c1), (short) (c0), (short) (c1))
+
+/* Interleave the low (h == 0) or high (h == 1) halves of a and b. */
+#define UNPACK_SSE2(h,a,b) \
+  ((h) ? _mm_unpackhi_epi16(a, b) : _mm_unpacklo_epi16(a, b))
+
+/* One 1-D IDCT on 8 vectors of 8 inputs, in place.  bias is the rounding
+ * term added to the DC input after scaling by CONST_BITS, and shift the
+ * final descale.  If range is not null, record in it whether any output
+ * is outside the range allowed for the next pass.
+ */
+INLINE
+LOCAL(void)
+idct_1d_sse2 (__m128i * d, __m128i bias, __m128i shift, __m128i * range)
+{
+  __m128i tmp0, tmp1, tmp2, tmp3;
+  __m128i tmp10, tmp11, tmp12, tmp13;
+  __m128i z1, z2, z3, z4, sum04, diff04;
+  __m128i out[2][DCTSIZE];
+  int h, i;
+
+  sum04 = _mm_add_epi16(d[0], d[4]);
+  diff04 = _mm_sub_epi16(d[0], d[4]);
+  z3 = _mm_add_epi16(d[7], d[3]);
+  z4 = _mm_add_epi16(d[5], d[1]);
+
+  for (h = 0; h < 2; h++) {
+    __m128i p26 = UNPACK_SSE2(h, d[2], d[6]);
+    __m128i p71 = UNPACK_SSE2(h, d[7], d[1]);
+    __m128i p53 = UNPACK_SSE2(h, d[5], d[3]);
+    __m128i p34 = UNPACK_SSE2(h, z3, z4);
+
+    /* Even part: z1 = (z2 + z3) * c(6) folded into both products. */
+
+    tmp2 = _mm_madd_epi16(p26, PAIR_SSE2(FIX_0_541196100 + FIX_0_765366865,
+					 FIX_0_541196100));
+    tmp3 = _mm_madd_epi16(p26, PAIR_SSE2(FIX_0_541196100,
+					 FIX_0_541196100 - FIX_1_847759065));
+
+    /* Moving a value to the high half of a 32-bit lane shifts it by 16. */
+    tmp0 = _mm_add_epi32(_mm_srai_epi32(UNPACK_SSE2(h, _mm_setzero_si128(),
+						    sum04), 16 - CONST_BITS),
+			 bias);
+    tmp1 = _mm_add_epi32(_mm_srai_epi32(UNPACK_SSE2(h, _mm_setzero_si128(),
+						    diff04), 16 - CONST_BITS),
+			 bias);
+
+    tmp10 = _mm_add_epi32(tmp0, tmp2);
+    tmp13 = _mm_sub_epi32(tmp0, tmp2);
+    tmp11 = _mm_add_epi32(tmp1, tmp3);
+    tmp12 = _mm_sub_epi32(tmp1, tmp3);
+
+    /* Odd part: z1 and z2 here are z2 and z3 of the scalar code, with
+     * its first z1 folded into each.
+     */
+
+    z1 = _mm_madd_epi16(p34, PAIR_SSE2(FIX_1_175875602 - FIX_1_961570560,
+				       FIX_1_175875602));
+    z2 = _mm_madd_epi16(p34, PAIR_SSE2(FIX_1_175875602,
+				       FIX_1_175875602 - FIX_0_390180644));
+
+    tmp0 = _mm_add_epi32(_mm_madd_epi16(p71,
+			   PAIR_SSE2(FIX_0_298631336 - FIX_0_899976223,
+				     - FIX_0_899976223)), z1);
+    tmp3 = _mm_add_epi32(_mm_madd_epi16(p71,
+			   PAIR_SSE2(- FIX_0_899976223,
+				     FIX_1_501321110 - FIX_0_899976223)), z2);
+    tmp1 = _mm_add_epi32(_mm_madd_epi16(p53,
+			   PAIR_SSE2(FIX_2_053119869 - FIX_2_562915447,
+				     - FIX_2_562915447)), z2);
+    tmp2 = _mm_add_epi32(_mm_madd_epi16(p53,
+			   PAIR_SSE2(- FIX_2_562915447,
+				     FIX_3_072711026 - FIX_2_562915447)), z1);
+
+    /* Final output stage */
+
+    out[h][0] = _mm_sra_epi32(_mm_add_epi32(tmp10, tmp3), shift);
+    out[h][7] = _mm_sra_epi32(_mm_sub_epi32(tmp10, tmp3), shift);
+    out[h][1] = _mm_sra_epi32(_mm_add_epi32(tmp11, tmp2), shift);
+    out[h][6] = _mm_sra_epi32(_mm_sub_epi32(tmp11, tmp2), shift);
+    out[h][2] = _mm_sra_epi32(_mm_add_epi32(tmp12, tmp1), shift);
+    out[h][5] = _mm_sra_epi32(_mm_sub_epi32(tmp12, tmp1), shift);
+    out[h][3] = _mm_sra_epi32(_mm_add_epi32(tmp13, tmp0), shift);
+    out[h][4] = _mm_sra_epi32(_mm_sub_epi32(tmp13, tmp0), shift);
+  }
+
+  for (i = 0; i < DCTSIZE; i++) {
+    if (range != NULL) {
+      /* Set bits above bit 14 iff an output is outside -2^14..2^14-1. */
+      *range = _mm_or_si128(*range,
+			    _mm_add_epi32(out[0][i], _mm_set1_epi32(0x4000)));
+      *range = _mm_or_si128(*range,
+			    _mm_add_epi32(out[1][i], _mm_set1_epi32(0x4000)));
+    }
+    d[i] = _mm_packs_epi32(out[0][i], out[1][i]);
+  }
+}
+
+/* Transpose the 8x8 block of 16-bit values held in d[0..7]. */
+INLINE
+LOCAL(void)
+transpose_sse2 (__m128i * d)
+{
+  __m128i a[DCTSIZE], b[DCTSIZE];
+  int i;
+
+  for (i = 0; i < DCTSIZE; i += 2) {
+    a[i] = _mm_unpacklo_epi16(d[i], d[i + 1]);
+    a[i + 1] = _mm_unpackhi_epi16(d[i], d[i + 1]);
+  }
+  b[0] = _mm_unpacklo_epi32(a[0], a[2]);
+  b[1] = _mm_unpackhi_epi32(a[0], a[2]);
+  b[2] = _mm_unpacklo_epi32(a[4], a[6]);
+  b[3] = _mm_unpackhi_epi32(a[4], a[6]);
+  b[4] = _mm_unpacklo_epi32(a[1], a[3]);
+  b[5] = _mm_unpackhi_epi32(a[1], a[3]);
+  b[6] = _mm_unpacklo_epi32(a[5], a[7]);
+  b[7] = _mm_unpackhi_epi32(a[5], a[7]);
+  d[0] = _mm_unpacklo_epi64(b[0], b[2]);
+  d[1] = _mm_unpackhi_epi64(b[0], b[2]);
+  d[2] = _mm_unpacklo_epi64(b[1], b[3]);
+  d[3] = _mm_unpackhi_epi64(b[1], b[3]);
+  d[4] = _mm_unpacklo_epi64(b[4], b[6]);
+  d[5] = _mm_unpackhi_epi64(b[4], b[6]);
+  d[6] = _mm_unpacklo_epi64(b[5], b[7]);
+  d[7] = _mm_unpackhi_epi64(b[5], b[7]);
+}
+
+LOCAL(boolean)
+idct_islow_sse2 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+		 JCOEFPTR coef_block,
+		 JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  ISLOW_MULT_TYPE * quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  __m128i d[DCTSIZE];
+  __m128i bad = _mm_setzero_si128();
+  __m128i range = _mm_setzero_si128();
+  __m128i c, q, lo, hi, s14;
+  int i;
+
+  /* Blocks with no AC terms at all are common enough (flat areas) to be
+   * worth the test, and the output is then a single value, computed as
+   * the scalar code does.
+   */
+  c = _mm_and_si128(_mm_loadu_si128((const __m128i *) coef_block),
+		    _mm_setr_epi16(0, -1, -1, -1, -1, -1, -1, -1));
+  for (i = 1; i < DCTSIZE; i++)
+    c = _mm_or_si128(c, _mm_loadu_si128((const __m128i *)
+					(coef_block + i * DCTSIZE)));
+  if (_mm_movemask_epi8(_mm_cmpeq_epi16(c, _mm_setzero_si128())) == 0xffff) {
+    JSAMPLE *range_limit = IDCT_range_limit(cinfo);
+    int dcval = DEQUANTIZE(coef_block[0], quantptr[0]) << PASS1_BITS;
+    SHIFT_TEMPS
+
+    c = _mm_set1_epi8((char) range_limit[(int) DESCALE((INT32) dcval,
+							PASS1_BITS+3)
+					 & RANGE_MASK]);
+    for (i = 0; i < DCTSIZE; i++)
+      _mm_storel_epi64((__m128i *) (output_buf[i] + output_col), c);
+    return TRUE;
+  }
+
+  /* Dequantize.  Row i of the block holds input i for every column.
+   * A product fits if its high half and bits 14-15 of its low half
+   * are all sign bits.  Quantization values above 32767 are clamped
+   * by the pack, so treat 32767 itself as out of range.
+   */
+  for (i = 0; i < DCTSIZE; i++) {
+    c = _mm_loadu_si128((const __m128i *) (coef_block + i * DCTSIZE));
+    if (SIZEOF(ISLOW_MULT_TYPE) == 2)
+      q = _mm_loadu_si128((const __m128i *) (quantptr + i * DCTSIZE));
+    else
+      q = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)
+					  (quantptr + i * DCTSIZE)),
+			  _mm_loadu_si128((const __m128i *)
+					  (quantptr + i * DCTSIZE + 4)));
+    lo = _mm_mullo_epi16(c, q);
+    hi = _mm_mulhi_epi16(c, q);
+    s14 = _mm_srai_epi16(lo, 14);
+    bad = _mm_or_si128(bad, _mm_xor_si128(hi, s14));
+    bad = _mm_or_si128(bad, _mm_xor_si128(s14, _mm_srai_epi16(lo, 15)));
+    bad = _mm_or_si128(bad, _mm_cmpeq_epi16(q, _mm_set1_epi16(0x7fff)));
+    d[i] = lo;
+  }
+  if (_mm_movemask_epi8(_mm_cmpeq_epi16(bad, _mm_setzero_si128())) != 0xffff)
+    return FALSE;
+
+  /* Pass 1: columns.  The scalar code's all-zero-AC shortcut gives the
+   * same results as the full calculation, so we don't need it here.
+   */
+  idct_1d_sse2(d, _mm_set1_epi32(ONE << (CONST_BITS-PASS1_BITS-1)),
+	       _mm_cvtsi32_si128(CONST_BITS-PASS1_BITS), &range);
+  if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_srli_epi32(range, 15),
+					_mm_setzero_si128())) != 0xffff)
+    return FALSE;
+
+  /* Pass 2: rows.  The rounding fudge is added to input 0 before the
+   * CONST_BITS scaling in the scalar code, which is the same thing.
+   */
+  transpose_sse2(d);
+  idct_1d_sse2(d, _mm_set1_epi32(ONE << (PASS1_BITS+2+CONST_BITS)),
+	       _mm_cvtsi32_si128(CONST_BITS+PASS1_BITS+3), NULL);
+  transpose_sse2(d);
+
+  /* Range limit: IDCT_range_limit maps x & RANGE_MASK to x + CENTERJSAMPLE
+   * clamped to 0..MAXJSAMPLE, with x taken as a signed 10-bit value.
+   * Sign-extend, recenter, and let the pack saturate.
+   */
+  for (i = 0; i < DCTSIZE; i++)
+    d[i] = _mm_add_epi16(_mm_srai_epi16(_mm_slli_epi16(d[i], 6), 6),
+			 _mm_set1_epi16(CENTERJSAMPLE));
+  for (i = 0; i < DCTSIZE; i += 2) {
+    c = _mm_packus_epi16(d[i], d[i + 1]);
+    _mm_storel_epi64((__m128i *) (output_buf[i] + output_col), c);
+    _mm_storel_epi64((__m128i *) (output_buf[i + 1] + output_col),
+		     _mm_srli_si128(c, 8));
+  }
+  return TRUE;
+}
+
+#endif /* HAVE_SSE2 */
+
+
 /*
  * Perform dequantization and inverse DCT on one block of coefficients.
  */
@@ -184,6 +427,11 @@ jpeg_idct_islow (j_decompress_ptr cinfo, jpeg_component_info * compptr,
   int workspace[DCTSIZE2];	/* buffers data between passes */
   SHIFT_TEMPS
 
+#if defined(HAVE_SSE2) && BITS_IN_JSAMPLE == 8
+  if (idct_islow_sse2(cinfo, compptr, coef_block, output_buf, output_col))
+    return;
+#endif
+
   /* Pass 1: process columns from input, store into work array. */
   /* Note results are scaled up by sqrt(8) compared to a true IDCT; */
   /* furthermore, we scale the results by 2**PASS1_BITS. */
@@ -34,6 +34,7 @@
 #include "gdebug.h"
 #include "gxbitmap.h"
 #include "gsmchunk.h"
+#include "gpsync.h"
 
 #include "stream.h"
 #include "gxiodev.h"            /* must come after stream.h */
@@ -64,8 +65,42 @@ typedef struct FF_server_s
     gs_memory_t *mem;
     FT_Memory ftmemory;
     struct  FT_MemoryRec_ ftmemory_rec;
+    struct FF_face_s *worker_face; /* The face that has the prefetch workers. */
 } FF_server;
 
+/* A prefetch worker : a private FreeType library with its own copy of
+ * a disk based face, so that it can render glyphs on another thread.
+ * Only one face at a time has workers. See prefetch_char_rasters.
+ */
+typedef struct FF_worker_s
+{
+    gs_memory_t *mem;
+    struct FT_MemoryRec_ ftmemory_rec;
+    FT_Library freetype_library;
+    FT_Face ft_face;
+    FT_Stream ftstrm;
+} FF_worker;
+
+/* A prefetched character raster waiting for get_char_raster_metrics,
+ * with the scaling it was rendered at.
+ */
+typedef struct FF_prefetched_s
+{
+    int index;
+    FT_Matrix ft_transform;
+    FT_F26Dot6 width, height;
+    FT_UInt horz_res;
+    FT_UInt vert_res;
+    bool is_vertical;
+    int max_bitmap;
+    bool anti_alias;
+    FAPI_metrics metrics;
+    FT_BitmapGlyph glyph;
+} FF_prefetched;
+
+#define FF_MAX_WORKERS 16
+#define FF_MAX_PREFETCHED 128
+
 typedef struct FF_face_s
 {
     FT_Face ft_face;
@@ -82,6 +117,12 @@ typedef struct FF_face_s
     FT_Stream ftstrm;
     /* Non-null if font data is owned by this object. */
     unsigned char *font_data;
+
+    /* Prefetch workers and the rasters they have rendered. */
+    FF_worker *workers;
+    int num_workers;
+    FF_prefetched *prefetched;
+    int num_prefetched;
 } FF_face;
 
 /* Here we define the struct FT_Incremental that is used as an opaque type
@@ -248,10 +289,57 @@ new_face(FAPI_server *a_server, FT_Face a_ft_face, FT_Incremental_InterfaceRec *
         face->ft_inc_int = a_ft_inc_int;
         face->font_data = a_font_data;
         face->ftstrm = ftstrm;
+        face->workers = NULL;
+        face->num_workers = 0;
+        face->prefetched = NULL;
+        face->num_prefetched = 0;
     }
     return face;
 }
 
+static void
+FF_worker_done(FF_worker *w)
+{
+    if (w->ft_face)
+        FT_Done_Face(w->ft_face);
+    if (w->ftstrm)
+        gs_free(w->mem, w->ftstrm, 0, 0, "FF_worker_done");
+    if (w->freetype_library)
+        FT_Done_Library(w->freetype_library);
+    if (w->mem)
+        gs_memory_chunk_release(w->mem);
+    memset(w, 0x00, sizeof(*w));
+}
+
+/* Free the prefetch workers of a face. */
+static void
+FF_stop_workers(FF_server *s, FF_face *a_face)
+{
+    int i;
+
+    for (i = 0; i < a_face->num_workers; i++)
+        FF_worker_done(&a_face->workers[i]);
+    FF_free(s->ftmemory, a_face->workers);
+    a_face->workers = NULL;
+    a_face->num_workers = 0;
+    if (s->worker_face == a_face)
+        s->worker_face = NULL;
+}
+
+static void
+FF_drop_prefetched(FF_server *s, FF_face *a_face)
+{
+    int i;
+
+    for (i = 0; i < a_face->num_prefetched; i++) {
+        FT_BitmapGlyph glyph = a_face->prefetched[i].glyph;
+
+        FT_Bitmap_Done (s->freetype_library, &glyph->bitmap);
+        FF_free(s->ftmemory, glyph);
+    }
+    a_face->num_prefetched = 0;
+}
+
 static void
 delete_face(FAPI_server *a_server, FF_face *a_face)
 {
@@ -259,6 +347,9 @@ delete_face(FAPI_server *a_server, FF_face *a_face)
     {
         FF_server *s = (FF_server*)a_server;
 
+        FF_drop_prefetched(s, a_face);
+        FF_free(s->ftmemory, a_face->prefetched);
+        FF_stop_workers(s, a_face);
         FT_Done_Face(a_face->ft_face);
         FF_free(s->ftmemory, a_face->ft_inc_int);
         FF_free(s->ftmemory, a_face->font_data);
@@ -469,18 +560,19 @@ ft_to_gs_error(FT_Error a_error)
     return 0;
 }
 
-/* Load a glyph and optionally rasterize it. Return its metrics in a_metrics.
- * If a_bitmap is true convert the glyph to a bitmap.
+/* Load a glyph into ft_face and optionally rasterize it. Return its metrics
+ * in a_metrics. If a_bitmap is true convert the glyph to a bitmap.
+ * The size and transformation are those of face; ft_face is either
+ * face->ft_face or a prefetch worker's copy of it, with its own library.
  */
 static FAPI_retcode
-load_glyph(FAPI_server *a_server, FAPI_font *a_fapi_font, const FAPI_char_ref *a_char_ref,
-        FAPI_metrics *a_metrics, FT_Glyph *a_glyph, bool a_bitmap, int max_bitmap)
+load_face_glyph(FT_Library library, FT_Memory ftmemory, FF_face *face, FT_Face ft_face,
+        FAPI_font *a_fapi_font, const FAPI_char_ref *a_char_ref,
+        FAPI_metrics *a_metrics, FT_Glyph *a_glyph, bool a_bitmap, int max_bitmap,
+        bool anti_alias)
 {
-    FF_server *s = (FF_server*)a_server;
     FT_Error ft_error = 0;
     FT_Error ft_error_fb = 1;
-    FF_face *face = (FF_face*)a_fapi_font->server_font_data;
-    FT_Face ft_face = face->ft_face;
     int index = a_char_ref->char_code;
     FT_Long w;
     FT_Long h;
@@ -493,17 +585,6 @@ load_glyph(FAPI_server *a_server, FAPI_font *a_fapi_font, const FAPI_char_ref *a
     const void *saved_char_data = a_fapi_font->char_data;
     const int saved_char_data_len = a_fapi_font->char_data_len;
 
-    if (s->bitmap_glyph) {
-        FT_Bitmap_Done (s->freetype_library, &s->bitmap_glyph->bitmap);
-        FF_free(s->ftmemory, s->bitmap_glyph);
-        s->bitmap_glyph = NULL;
-    }
-    if (s->outline_glyph) {
-        FT_Outline_Done (s->freetype_library, &s->outline_glyph->outline);
-        FF_free(s->ftmemory, s->outline_glyph);
-        s->outline_glyph = NULL;
-    }
-
     if (!a_char_ref->is_glyph_index)
     {
         if (ft_face->num_charmaps)
@@ -655,8 +736,8 @@ load_glyph(FAPI_server *a_server, FAPI_font *a_fapi_font, const FAPI_char_ref *a
         h = (FT_UInt)(( cbox.yMax - cbox.yMin ) >> 6 );
 
         if (ft_face->glyph->format != FT_GLYPH_FORMAT_BITMAP && ft_face->glyph->format != FT_GLYPH_FORMAT_COMPOSITE) {
-            if ((bitmap_raster(w) * h) < max_bitmap) {
-               FT_Render_Mode  mode = FT_RENDER_MODE_MONO;
+            if (((anti_alias ? w : bitmap_raster(w)) * h) < max_bitmap) {
+               FT_Render_Mode  mode = (anti_alias ? FT_RENDER_MODE_NORMAL : FT_RENDER_MODE_MONO);
 
                ft_error = FT_Render_Glyph(ft_face->glyph, mode);
             }
@@ -675,16 +756,16 @@ load_glyph(FAPI_server *a_server, FAPI_font *a_fapi_font, const FAPI_char_ref *a
             FT_BitmapGlyph bmg;
             ft_error = FT_Get_Glyph(ft_face->glyph, (FT_Glyph *)&bmg);
             if (!ft_error) {
-                FT_Bitmap_Done (s->freetype_library, &bmg->bitmap);
-                FF_free(s->ftmemory, bmg);
+                FT_Bitmap_Done (library, &bmg->bitmap);
+                FF_free(ftmemory, bmg);
             }
         }
         else {
             FT_OutlineGlyph olg;
             ft_error = FT_Get_Glyph(ft_face->glyph, (FT_Glyph *)&olg);
             if (!ft_error) {
-                FT_Outline_Done (s->freetype_library, &olg->outline);
-                FF_free(s->ftmemory, olg);
+                FT_Outline_Done (library, &olg->outline);
+                FF_free(ftmemory, olg);
             }
         }
     }
@@ -748,6 +829,317 @@ load_glyph(FAPI_server *a_server, FAPI_font *a_fapi_font, const FAPI_char_ref *a
     return ft_to_gs_error(ft_error);
 }
 
+static void
+FF_free_glyphs(FF_server *s)
+{
+    if (s->bitmap_glyph) {
+        FT_Bitmap_Done (s->freetype_library, &s->bitmap_glyph->bitmap);
+        FF_free(s->ftmemory, s->bitmap_glyph);
+        s->bitmap_glyph = NULL;
+    }
+    if (s->outline_glyph) {
+        FT_Outline_Done (s->freetype_library, &s->outline_glyph->outline);
+        FF_free(s->ftmemory, s->outline_glyph);
+        s->outline_glyph = NULL;
+    }
+}
+
+static FAPI_retcode
+load_glyph(FAPI_server *a_server, FAPI_font *a_fapi_font, const FAPI_char_ref *a_char_ref,
+        FAPI_metrics *a_metrics, FT_Glyph *a_glyph, bool a_bitmap, int max_bitmap)
+{
+    FF_server *s = (FF_server*)a_server;
+    FF_face *face = (FF_face*)a_fapi_font->server_font_data;
+
+    FF_free_glyphs(s);
+    return load_face_glyph(s->freetype_library, s->ftmemory, face, face->ft_face,
+                           a_fapi_font, a_char_ref, a_metrics, a_glyph, a_bitmap, max_bitmap,
+                           a_server->anti_alias);
+}
+
+/*
+ * Character prefetch.
+ *
+ * Glyphs reach the server one at a time through the interpreter, so the
+ * client looks ahead in the text and passes the characters that will miss
+ * the character cache to prefetch_char_rasters. These are rendered on
+ * worker threads, each with its own FreeType library and face, and kept
+ * until get_char_raster_metrics asks for them. Only disk based faces
+ * are prefetched : the others get their glyph data from the interpreter.
+ */
+
+static int
+FF_worker_init(FF_server *s, FAPI_font *a_font, FF_worker *w)
+{
+    FT_Open_Args args;
+    FT_Error ft_error;
+    int code = 0;
+
+    memset(w, 0x00, sizeof(*w));
+    code = gs_memory_chunk_wrap(&w->mem, s->mem->thread_safe_memory);
+    if (code < 0)
+        return code;
+    w->ftmemory_rec.user = w->mem;
+    w->ftmemory_rec.alloc = FF_alloc;
+    w->ftmemory_rec.free = FF_free;
+    w->ftmemory_rec.realloc = FF_realloc;
+    ft_error = FT_New_Library(&w->ftmemory_rec, &w->freetype_library);
+    if (!ft_error) {
+        FT_Add_Default_Modules(w->freetype_library);
+        code = FF_open_read_stream(w->mem, (char *)a_font->font_file_path, &w->ftstrm);
+        if (code >= 0) {
+            memset(&args, 0x00, sizeof(args));
+            args.flags = FT_OPEN_STREAM;
+            args.stream = w->ftstrm;
+            ft_error = FT_Open_Face(w->freetype_library, &args, a_font->subfont, &w->ft_face);
+            if (!ft_error)
+                (void)FT_Select_Charmap(w->ft_face, ft_encoding_unicode);
+        }
+    }
+    if (code < 0 || ft_error) {
+        FF_worker_done(w);
+        return code < 0 ? code : ft_to_gs_error(ft_error);
+    }
+    return 0;
+}
+
+/*
+ * Make up to n workers for a face. The workers persist with the face until
+ * another face needs workers : each one holds a FreeType library and an
+ * open copy of the font file, so they aren't kept for faces that are idle.
+ */
+static void
+FF_start_workers(FF_server *s, FAPI_font *a_font, FF_face *face, int n)
+{
+    if (s->worker_face != NULL && s->worker_face != face)
+        FF_stop_workers(s, s->worker_face);
+    if (face->workers == NULL) {
+        gs_memory_status_t mem_status;
+
+        /* The workers' chunk allocators need a thread-safe base allocator. */
+        gs_memory_status(s->mem->thread_safe_memory, &mem_status);
+        if (!mem_status.is_thread_safe)
+            return;
+        face->workers = (FF_worker *)FF_alloc(s->ftmemory, FF_MAX_WORKERS * sizeof(FF_worker));
+        if (face->workers == NULL)
+            return;
+        memset(face->workers, 0x00, FF_MAX_WORKERS * sizeof(FF_worker));
+        s->worker_face = face;
+    }
+    if (n > FF_MAX_WORKERS)
+        n = FF_MAX_WORKERS;
+    while (face->num_workers < n &&
+           FF_worker_init(s, a_font, &face->workers[face->num_workers]) >= 0)
+        face->num_workers++;
+}
+
+static int
+FF_find_prefetched(const FF_face *face, const FAPI_font *a_font,
+        const FAPI_char_ref *a_char_ref, int max_bitmap, bool anti_alias)
+{
+    int i;
+
+    for (i = 0; i < face->num_prefetched; i++) {
+        const FF_prefetched *p = &face->prefetched[i];
+
+        if (p->index == a_char_ref->char_code &&
+            p->max_bitmap == max_bitmap && p->anti_alias == anti_alias &&
+            p->is_vertical == a_font->is_vertical &&
+            p->width == face->width && p->height == face->height &&
+            p->horz_res == face->horz_res && p->vert_res == face->vert_res &&
+            p->ft_transform.xx == face->ft_transform.xx &&
+            p->ft_transform.xy == face->ft_transform.xy &&
+            p->ft_transform.yx == face->ft_transform.yx &&
+            p->ft_transform.yy == face->ft_transform.yy)
+            return i;
+    }
+    return -1;
+}
+
+/* Copy a bitmap glyph rendered by a worker into the server's memory. */
+static FT_BitmapGlyph
+FF_copy_bitmap_glyph(FF_server *s, FT_BitmapGlyph src)
+{
+    FT_BitmapGlyph glyph = (FT_BitmapGlyph)FF_alloc(s->ftmemory, sizeof(*glyph));
+    long size = (long)(src->bitmap.pitch < 0 ? -src->bitmap.pitch : src->bitmap.pitch) *
+                src->bitmap.rows;
+
+    if (glyph == NULL)
+        return NULL;
+    *glyph = *src;
+    glyph->root.library = s->freetype_library;
+    glyph->bitmap.buffer = NULL;
+    if (size > 0) {
+        glyph->bitmap.buffer = (unsigned char *)FF_alloc(s->ftmemory, size);
+        if (glyph->bitmap.buffer == NULL) {
+            FF_free(s->ftmemory, glyph);
+            return NULL;
+        }
+        memcpy(glyph->bitmap.buffer, src->bitmap.buffer, size);
+    }
+    return glyph;
+}
+
+typedef struct FF_prefetch_slot_s
+{
+    FT_Library freetype_library;
+    FT_Memory ftmemory;
+    FT_Face ft_face;
+    FF_face *face;
+    FAPI_font ff; /* A private copy : load_face_glyph changes char_data. */
+    const FAPI_char_ref *char_refs;
+    int first, count, step;
+    int max_bitmap;
+    bool anti_alias;
+    FT_Glyph *glyphs;
+    FAPI_metrics *metrics;
+    FAPI_retcode *codes;
+    gp_thread_id thread;
+} FF_prefetch_slot;
+
+static void
+FF_prefetch_thread(void *data)
+{
+    FF_prefetch_slot *slot = (FF_prefetch_slot *)data;
+    int i;
+
+    for (i = slot->first; i < slot->count; i += slot->step)
+        slot->codes[i] = load_face_glyph(slot->freetype_library, slot->ftmemory,
+                                slot->face, slot->ft_face, &slot->ff,
+                                &slot->char_refs[i], &slot->metrics[i],
+                                &slot->glyphs[i], true, slot->max_bitmap,
+                                slot->anti_alias);
+}
+
+static FAPI_retcode
+prefetch_char_rasters(FAPI_server *a_server, FAPI_font *a_font,
+        const FAPI_char_ref *a_char_refs, int count, int threads)
+{
+    FF_server *s = (FF_server*)a_server;
+    FF_face *face = (FF_face*)a_font->server_font_data;
+    FF_prefetch_slot *slots = NULL;
+    FT_Glyph *glyphs = NULL;
+    FAPI_metrics *metrics = NULL;
+    FAPI_retcode *codes = NULL;
+    FAPI_char_ref *char_refs = NULL;
+    int nslots, n, i;
+
+    /* More threads than processors would only add overhead. */
+    if (threads > gp_get_cpu_count())
+        threads = gp_get_cpu_count();
+    if (face == NULL || face->ft_inc_int != NULL || a_font->font_file_path == NULL ||
+        a_server->use_outline || threads < 2 || count < 2)
+        return 0;
+    FF_start_workers(s, a_font, face, threads - 1);
+    if (face->num_workers == 0)
+        return 0;
+    if (face->prefetched == NULL) {
+        face->prefetched = (FF_prefetched *)FF_alloc(s->ftmemory,
+                                   FF_MAX_PREFETCHED * sizeof(FF_prefetched));
+        if (face->prefetched == NULL)
+            return 0;
+    }
+    if (count > FF_MAX_PREFETCHED)
+        count = FF_MAX_PREFETCHED;
+    if (face->num_prefetched + count > FF_MAX_PREFETCHED)
+        FF_drop_prefetched(s, face);
+    for (i = 0; i < face->num_workers; i++) {
+        FT_Face ft_face = face->workers[i].ft_face;
+
+        if (FT_Set_Char_Size(ft_face, face->width, face->height,
+                             face->horz_res, face->vert_res))
+            return 0;
+        FT_Set_Transform(ft_face, &face->ft_transform, NULL);
+    }
+
+    char_refs = (FAPI_char_ref *)gs_malloc(s->mem, count, sizeof(FAPI_char_ref), "prefetch_char_rasters");
+    glyphs = (FT_Glyph *)gs_malloc(s->mem, count, sizeof(FT_Glyph), "prefetch_char_rasters");
+    metrics = (FAPI_metrics *)gs_malloc(s->mem, count, sizeof(FAPI_metrics), "prefetch_char_rasters");
+    codes = (FAPI_retcode *)gs_malloc(s->mem, count, sizeof(FAPI_retcode), "prefetch_char_rasters");
+    slots = (FF_prefetch_slot *)gs_malloc(s->mem, face->num_workers + 1, sizeof(FF_prefetch_slot),
+                                          "prefetch_char_rasters");
+    if (char_refs == NULL || glyphs == NULL || metrics == NULL || codes == NULL || slots == NULL)
+        goto done;
+
+    /* Skip what is already here or cannot be matched by glyph index. */
+    for (i = n = 0; i < count; i++)
+        if (a_char_refs[i].is_glyph_index &&
+            FF_find_prefetched(face, a_font, &a_char_refs[i], a_server->max_bitmap,
+                               a_server->anti_alias) < 0)
+            char_refs[n++] = a_char_refs[i];
+    if (n < 2)
+        goto done;
+    for (i = 0; i < n; i++)
+        glyphs[i] = NULL;
+
+    /* Slot 0 renders with the server's own face on this thread. */
+    nslots = min(face->num_workers + 1, n);
+    for (i = 0; i < nslots; i++) {
+        FF_prefetch_slot *slot = &slots[i];
+
+        if (i == 0) {
+            slot->freetype_library = s->freetype_library;
+            slot->ftmemory = s->ftmemory;
+            slot->ft_face = face->ft_face;
+        } else {
+            slot->freetype_library = face->workers[i - 1].freetype_library;
+            slot->ftmemory = &face->workers[i - 1].ftmemory_rec;
+            slot->ft_face = face->workers[i - 1].ft_face;
+        }
+        slot->face = face;
+        slot->ff = *a_font;
+        slot->char_refs = char_refs;
+        slot->first = i;
+        slot->count = n;
+        slot->step = nslots;
+        slot->max_bitmap = a_server->max_bitmap;
+        slot->anti_alias = a_server->anti_alias;
+        slot->glyphs = glyphs;
+        slot->metrics = metrics;
+        slot->codes = codes;
+        slot->thread = 0;
+        if (i > 0 && gp_thread_start(FF_prefetch_thread, slot, &slot->thread) < 0) {
+            slot->thread = 0;
+            FF_prefetch_thread(slot);
+        }
+    }
+    FF_prefetch_thread(&slots[0]);
+    for (i = 1; i < nslots; i++)
+        if (slots[i].thread != 0)
+            gp_thread_finish(slots[i].thread);
+
+    for (i = 0; i < n; i++) {
+        if (glyphs[i] == NULL)
+            continue;
+        if (codes[i] == 0 && glyphs[i]->format == FT_GLYPH_FORMAT_BITMAP) {
+            FF_prefetched *p = &face->prefetched[face->num_prefetched];
+
+            p->glyph = FF_copy_bitmap_glyph(s, (FT_BitmapGlyph)glyphs[i]);
+            if (p->glyph != NULL) {
+                p->index = char_refs[i].char_code;
+                p->ft_transform = face->ft_transform;
+                p->width = face->width;
+                p->height = face->height;
+                p->horz_res = face->horz_res;
+                p->vert_res = face->vert_res;
+                p->is_vertical = a_font->is_vertical;
+                p->max_bitmap = a_server->max_bitmap;
+                p->anti_alias = a_server->anti_alias;
+                p->metrics = metrics[i];
+                face->num_prefetched++;
+            }
+        }
+        FT_Done_Glyph(glyphs[i]);
+    }
+done:
+    gs_free(s->mem, slots, 0, 0, "prefetch_char_rasters");
+    gs_free(s->mem, codes, 0, 0, "prefetch_char_rasters");
+    gs_free(s->mem, metrics, 0, 0, "prefetch_char_rasters");
+    gs_free(s->mem, glyphs, 0, 0, "prefetch_char_rasters");
+    gs_free(s->mem, char_refs, 0, 0, "prefetch_char_rasters");
+    return 0;
+}
+
 /*
  * Ensure that the rasterizer is open.
  *
@@ -1355,8 +1747,24 @@ get_char_raster_metrics(FAPI_server *a_server, FAPI_font *a_font,
         FAPI_char_ref *a_char_ref, FAPI_metrics *a_metrics)
 {
     FF_server *s = (FF_server*)a_server;
-    FAPI_retcode error = load_glyph(a_server, a_font, a_char_ref, a_metrics,
-                                    (FT_Glyph*)&s->bitmap_glyph, true, a_server->max_bitmap);
+    FF_face *face = (FF_face*)a_font->server_font_data;
+    FAPI_retcode error;
+
+    /* Use a prefetched raster if there is one. */
+    if (face && face->num_prefetched > 0 && a_char_ref->is_glyph_index) {
+        int i = FF_find_prefetched(face, a_font, a_char_ref, a_server->max_bitmap,
+                                   a_server->anti_alias);
+
+        if (i >= 0) {
+            FF_free_glyphs(s);
+            s->bitmap_glyph = face->prefetched[i].glyph;
+            *a_metrics = face->prefetched[i].metrics;
+            face->prefetched[i] = face->prefetched[--face->num_prefetched];
+            return 0;
+        }
+    }
+    error = load_glyph(a_server, a_font, a_char_ref, a_metrics,
+                       (FT_Glyph*)&s->bitmap_glyph, true, a_server->max_bitmap);
     return error;
 }
 
@@ -1370,6 +1778,7 @@ get_char_raster(FAPI_server *a_server, FAPI_raster *a_raster)
     if (!s->bitmap_glyph)
         return_error(e_unregistered); /* Must not happen. */
     a_raster->p = s->bitmap_glyph->bitmap.buffer;
+    a_raster->depth = (s->bitmap_glyph->bitmap.pixel_mode == FT_PIXEL_MODE_GRAY ? 8 : 1);
     a_raster->width = s->bitmap_glyph->bitmap.width;
     a_raster->height = s->bitmap_glyph->bitmap.rows;
     a_raster->line_step = s->bitmap_glyph->bitmap.pitch;
@@ -1575,6 +1984,7 @@ static const FAPI_server TheFreeTypeServer =
     {0},
     0,
     false,
+    false,
     {1, 0, 0, 1, 0, 0},
     ensure_open,
     get_scaled_font,
@@ -1591,7 +2001,8 @@ static const FAPI_server TheFreeTypeServer =
     get_char_outline,
     release_char_data,
     release_typeface,
-    check_cmap_for_GID
+    check_cmap_for_GID,
+    prefetch_char_rasters
 };
 
 plugin_instantiation_proc(gs_fapi_ft_instantiate);
@@ -228,6 +228,7 @@ static FAPI_retcode get_char_raster(FAPI_server *server, FAPI_raster *rast)
     Bitstream_face *face = (Bitstream_face*)ff->server_font_data;
 
     rast->p = face->T2K->baseAddr;
+    rast->depth = 1;
     rast->width = face->T2K->width;
     rast->height = face->T2K->height;
     rast->line_step = face->T2K->rowBytes;
@@ -295,6 +296,7 @@ static const FAPI_server If0 = {
     {0},
     0,
     false,
+    false,
     {1, 0, 0, 1, 0, 0},
     ensure_open,
     get_scaled_font,
@@ -311,7 +313,8 @@ static const FAPI_server If0 = {
     get_char_outline,
     release_char_data,
     release_typeface,
-    check_cmap_for_GID
+    check_cmap_for_GID,
+    NULL /* prefetch_char_rasters */
 };
 
 plugin_instantiation_proc(gs_fapibstm_instantiate);      /* check prototype */
@@ -1567,9 +1567,11 @@ static FAPI_retcode get_char_raster(FAPI_server *server, FAPI_raster *rast)
     else if (r->char_data == NULL) {
         rast->height = rast->width = rast->line_step = 0;
         rast->p = 0;
+        rast->depth = 1;
     } else {
         IFBITMAP *pbm = (IFBITMAP *)r->char_data;
         rast->p = pbm->bm;
+        rast->depth = 1;
         rast->height = pbm->top_indent + pbm->black_depth;
         rast->width = pbm->left_indent + pbm->black_width;
         rast->line_step = pbm->width;
@@ -1659,6 +1661,7 @@ static const FAPI_server If0 = {
     {0},
     0,
     false,
+    false,
     {1, 0, 0, 1, 0, 0},
     ensure_open,
     get_scaled_font,
@@ -1675,7 +1678,8 @@ static const FAPI_server If0 = {
     get_char_outline,
     release_char_data,
     FAPIU_release_typeface,
-    check_cmap_for_GID
+    check_cmap_for_GID,
+    NULL /* prefetch_char_rasters */
 };
 
 static int fapiu_make_string (i_ctx_t *i_ctx_p, const char *str, ref *obj)
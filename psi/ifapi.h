@@ -173,8 +173,9 @@ typedef struct FAPI_metrics_s {
     int em_x, em_y; /* design units */
 } FAPI_metrics;
 
-typedef struct { /* 1bit/pixel only, rows are byte-aligned. */
+typedef struct { /* rows are byte-aligned. */
     void *p;
+    int depth; /* 1, or 8 for coverage values, see anti_alias. */
     int width, height, line_step;
     int orig_x, orig_y; /* origin, 1/16s pixel */
     int left_indent, top_indent;
@@ -200,6 +201,7 @@ struct FAPI_server_s {
     FAPI_font ff;
     int max_bitmap;
     bool use_outline;
+    bool anti_alias; /* Render coverage values rather than a bitmap, if possible. */
     gs_matrix initial_FontMatrix; /* Font Matrix at the time the font is defined */
                                   /* Used to use the stored 'OrigFont' entry but */
                                   /* this did not change f a font was defined    */
@@ -220,6 +222,13 @@ struct FAPI_server_s {
     FAPI_retcode (*release_char_data)(FAPI_server *server);
     FAPI_retcode (*release_typeface)(FAPI_server *server, void *server_font_data);
     FAPI_retcode (*check_cmap_for_GID)(FAPI_server *server, uint *index);
+    /*  prefetch_char_rasters is optional (may be NULL). It renders the rasters
+        of 'count' characters of the current scaled font ahead of time, using up to
+        'threads' threads, so that later get_char_raster_metrics calls for them
+        return at once. Errors are not reported : characters which fail are
+        rendered again by get_char_raster_metrics.
+    */
+    FAPI_retcode (*prefetch_char_rasters)(FAPI_server *server, FAPI_font *ff, const FAPI_char_ref *c, int count, int threads);
     /*  Some people get confused with terms "font cache" and "character cache".
         "font cache" means a cache for scaled font objects, which mainly
         keep the font header information and rules for adjusting it to specific raster.
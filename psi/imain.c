@@ -24,6 +24,7 @@
 #include "gslib.h"
 #include "gsmatrix.h"           /* for gxdevice.h */
 #include "gsutil.h"             /* for bytes_compare */
+#include "gsfont.h"             /* for gs_font_dir_save_glyphs */
 #include "gxdevice.h"
 #include "gxalloc.h"
 #include "gxiodev.h"            /* for iodev struct */
@@ -874,6 +875,9 @@ gs_main_finit(gs_main_instance * minst, int exit_status, int code)
         print_resource_usage(minst, &gs_imemory, "Final");
         dprintf1("%% Exiting instance 0x%p\n", minst);
     }
+    /* Write back the glyphs rendered for the persistent cache. */
+    if (minst->init_done >= 1 && minst->heap->gs_lib_ctx->font_dir != 0)
+        gs_font_dir_save_glyphs(minst->heap->gs_lib_ctx->font_dir);
     /* Do the equivalent of a restore "past the bottom". */
     /* This will release all memory, close all open files, etc. */
     if (minst->init_done >= 1) {
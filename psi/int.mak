@@ -485,6 +485,11 @@ $(PSOBJ)zfontenum.$(OBJ) : $(PSSRC)zfontenum.c $(OP)\
  $(memory__h) $(gsstruct_h) $(ialloc_h) $(idict_h)
 	$(PSCC) $(PSO_)zfontenum.$(OBJ) $(C_) $(PSSRC)zfontenum.c
 
+$(PSOBJ)zfontidx.$(OBJ) : $(PSSRC)zfontidx.c $(OP) $(memory__h)\
+ $(gp_h) $(gscdefs_h) $(ialloc_h) $(iname_h) $(iutil_h) $(md5_h) $(store_h)\
+ $(stream_h) $(files_h)
+	$(PSCC) $(PSO_)zfontidx.$(OBJ) $(C_) $(PSSRC)zfontidx.c
+
 $(PSOBJ)zgstate.$(OBJ) : $(PSSRC)zgstate.c $(OP) $(math__h)\
  $(gsmatrix_h)\
  $(ialloc_h) $(icremap_h) $(idict_h) $(igstate_h) $(istruct_h) $(store_h)
@@ -532,7 +537,8 @@ Z5=$(PSOBJ)zmisc.$(OBJ) $(PSOBJ)zpacked.$(OBJ) $(PSOBJ)zrelbit.$(OBJ)
 Z6=$(PSOBJ)zstack.$(OBJ) $(PSOBJ)zstring.$(OBJ) $(PSOBJ)zsysvm.$(OBJ)
 Z7=$(PSOBJ)ztoken.$(OBJ) $(PSOBJ)ztype.$(OBJ) $(PSOBJ)zvmem.$(OBJ)
 Z8=$(PSOBJ)zbfont.$(OBJ) $(PSOBJ)zchar.$(OBJ) $(PSOBJ)zcolor.$(OBJ)
-Z9=$(PSOBJ)zdevice.$(OBJ) $(PSOBJ)zfont.$(OBJ) $(PSOBJ)zfontenum.$(OBJ) $(PSOBJ)zgstate.$(OBJ)
+Z9=$(PSOBJ)zdevice.$(OBJ) $(PSOBJ)zfont.$(OBJ) $(PSOBJ)zfontenum.$(OBJ) $(PSOBJ)zfontidx.$(OBJ)\
+ $(PSOBJ)zgstate.$(OBJ)
 Z10=$(PSOBJ)zdfilter.$(OBJ) $(PSOBJ)zht.$(OBJ) $(PSOBJ)zimage.$(OBJ) $(PSOBJ)zmatrix.$(OBJ)
 Z11=$(PSOBJ)zpaint.$(OBJ) $(PSOBJ)zpath.$(OBJ)
 Z12=$(PSOBJ)zncdummy.$(OBJ)
@@ -541,7 +547,7 @@ Z2OPS=zdict1 zdict2 zfile zfile1 zfileio1 zfileio2
 Z3_4OPS=zfilter zfproc zgeneric ziodev zmath zalg
 Z5_6OPS=zmisc zpacked zrelbit zstack zstring zsysvm
 Z7_8OPS=ztoken ztype zvmem zbfont zchar_a zchar_b zcolor zcolor_ext
-Z9OPS=zdevice zfont zfontenum zgstate1 zgstate2 zgstate3
+Z9OPS=zdevice zfont zfontenum zfontidx zgstate1 zgstate2 zgstate3
 Z10OPS=zdfilter zht zimage zmatrix zmatrix2
 Z11OPS=zpaint zpath pantone
 # We have to be a little underhanded with *config.$(OBJ) so as to avoid
@@ -905,8 +911,8 @@ $(PSD)fzlib.dev : $(INT_MAK) $(ECHOGS_XE) $(fzlib_)\
 	$(ADDMOD) $(PSD)fzlib -oper zfzlib
 
 $(PSOBJ)zfzlib.$(OBJ) : $(PSSRC)zfzlib.c $(OP)\
- $(idict_h) $(idparam_h) $(ifilter_h) $(ifrpred_h) $(ifwpred_h)\
- $(spdiffx_h) $(spngpx_h) $(strimpl_h) $(szlibx_h)
+ $(idict_h) $(idparam_h) $(ifilter_h) $(ifilter2_h) $(ifrpred_h) $(ifwpred_h)\
+ $(scfx_h) $(slzwx_h) $(spdiffx_h) $(spngpx_h) $(strimpl_h) $(szlibx_h)
 	$(PSCC) $(PSO_)zfzlib.$(OBJ) $(C_) $(PSSRC)zfzlib.c
 
 # ---------------- ReusableStreamDecode filter ---------------- #
@@ -1540,7 +1546,7 @@ $(PSD)dctd.dev : $(INT_MAK) $(ECHOGS_XE) $(GLD)sdctd.dev $(GLD)sddparam.dev $(dc
 	$(ADDMOD) $(PSD)dctd -oper zfdctd
 
 $(PSOBJ)zfdctd.$(OBJ) : $(PSSRC)zfdctd.c $(OP)\
- $(memory__h) $(stdio__h) $(jpeglib__h) $(gsmemory_h)\
+ $(memory__h) $(stdio__h) $(jpeglib__h) $(gsmemory_h) $(gsstate_h)\
  $(ialloc_h) $(ifilter_h) $(iparam_h) $(sdct_h) $(sjpeg_h) $(strimpl_h)
 	$(PSCC) $(PSO_)zfdctd.$(OBJ) $(C_) $(PSSRC)zfdctd.c
 
@@ -1956,7 +1962,7 @@ $(PSD)fapif1.dev : $(INT_MAK) $(ECHOGS_XE) $(PSOBJ)fapi_ft.$(OBJ) \
 	$(ADDMOD) $(PSD)fapif1 -include $(GLD)freetype
 
 $(PSOBJ)fapi_ft.$(OBJ) : $(PSSRC)fapi_ft.c $(AK)\
- $(stdio__h) $(math__h) $(ifapi_h) $(gserrors_h)\
+ $(stdio__h) $(math__h) $(ifapi_h) $(gserrors_h) $(gpsync_h)\
  $(write_t1_h) $(write_t2_h)
 	$(PSCC) $(FT_CFLAGS) $(PSO_)fapi_ft.$(OBJ) $(C_) $(PSSRC)fapi_ft.c
 
@@ -2038,7 +2044,7 @@ $(PSOBJ)imainarg.$(OBJ) : $(PSSRC)imainarg.c $(GH)\
 	$(PSCC) $(PSO_)imainarg.$(OBJ) $(C_) $(PSSRC)imainarg.c
 
 $(PSOBJ)imain.$(OBJ) : $(PSSRC)imain.c $(GH) $(memory__h) $(string__h)\
- $(gp_h) $(gscdefs_h) $(gslib_h) $(gsmatrix_h) $(gsutil_h)\
+ $(gp_h) $(gscdefs_h) $(gslib_h) $(gsmatrix_h) $(gsutil_h) $(gsfont_h)\
  $(gxalloc_h) $(gxdevice_h) $(gzstate_h)\
  $(dstack_h) $(ierrors_h) $(estack_h) $(files_h)\
  $(ialloc_h) $(iconf_h) $(idebug_h) $(idict_h) $(idisp_h) $(iinit_h)\
@@ -47,6 +47,76 @@
 #define recognize_btokens()\
   (ref_binary_object_format.value.intval != 0 && level2_enabled)
 
+/*
+ * Bulk classification for the common cases of whitespace runs and names.
+ * These only ever skip whole 16-byte blocks whose every byte is known to
+ * be whitespace (respectively an ordinary name character, i.e. a letter,
+ * a digit or one of + - . , : ;); whatever is left over is handled by the
+ * table-driven code in gs_scan_token, so they need not recognize every
+ * member of a class.  Both return the first byte not skipped, and never
+ * read at or beyond limit.
+ */
+#ifdef HAVE_SSE2
+
+#include <emmintrin.h>
+
+static inline const byte *
+scan_skip_space_blocks(const byte *p, const byte *limit)
+{
+    const __m128i sp = _mm_set1_epi8(' ');
+    const __m128i nl = _mm_set1_epi8(char_EOL);
+    const __m128i cr = _mm_set1_epi8(char_CR);
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i ff = _mm_set1_epi8('\f');
+    const __m128i nul = _mm_setzero_si128();
+
+    while (limit - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        __m128i m = _mm_or_si128(
+                        _mm_or_si128(_mm_cmpeq_epi8(v, sp), _mm_cmpeq_epi8(v, nl)),
+                        _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, tab)));
+
+        m = _mm_or_si128(m, _mm_or_si128(_mm_cmpeq_epi8(v, ff),
+                                         _mm_cmpeq_epi8(v, nul)));
+        if (_mm_movemask_epi8(m) != 0xffff)
+            break;
+        p += 16;
+    }
+    return p;
+}
+
+/* Test for x in [lo, hi]; all bounds are below 0x80, so signed compares do. */
+#define in_range_epi8(v, lo, hi)\
+  _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8((lo) - 1)),\
+                _mm_cmplt_epi8(v, _mm_set1_epi8((hi) + 1)))
+
+static inline const byte *
+scan_skip_name_blocks(const byte *p, const byte *limit)
+{
+    while (limit - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        __m128i m = _mm_or_si128(
+                        _mm_or_si128(in_range_epi8(v, '+', '.'),
+                                     in_range_epi8(v, '0', ';')),
+                        _mm_or_si128(in_range_epi8(v, '@', 'Z'),
+                                     in_range_epi8(v, 'a', 'z')));
+
+        if (_mm_movemask_epi8(m) != 0xffff)
+            break;
+        p += 16;
+    }
+    return p;
+}
+
+#undef in_range_epi8
+
+#else
+
+#define scan_skip_space_blocks(p, limit) (p)
+#define scan_skip_name_blocks(p, limit) (p)
+
+#endif /* HAVE_SSE2 */
+
 /* Procedure for handling DSC comments if desired. */
 /* Set at initialization if a DSC handling module is included. */
 int (*gs_scan_dsc_proc) (const byte *, uint) = NULL;
@@ -572,6 +642,10 @@ gs_scan_token(i_ctx_t *i_ctx_p, ref * pref, scanner_state * pstate)
         case char_CR:
         case char_EOL:
         case char_NULL:
+            /* Swallow the rest of a whitespace run without redispatching. */
+            sptr = scan_skip_space_blocks(sptr + 1, endptr + 1) - 1;
+            while (sptr < endptr && decoder[sptr[1]] == ctype_space)
+                sptr++;
             goto top;
         case 0x04:              /* see ctrld above */
             if (c == ctrld)     /* treat as ordinary name char */
@@ -920,13 +994,28 @@ gs_scan_token(i_ctx_t *i_ctx_p, ref * pref, scanner_state * pstate)
             retcode = scan_number(sptr + (sign & 1),
                     endptr /*(*endptr == char_CR ? endptr : endptr + 1) */ ,
                                   sign, myref, &newptr, i_ctx_p->scanner_options);
-            if (retcode == 1 && decoder[newptr[-1]] == ctype_space) {
-                sptr = newptr - 1;
-                if (*sptr == char_CR && sptr[1] == char_EOL)
-                    sptr++;
-                retcode = 0;
-                ref_mark_new(myref);
-                break;
+            if (retcode == 1) {
+                switch (decoder[newptr[-1]]) {
+                    case ctype_space:
+                        sptr = newptr - 1;
+                        if (*sptr == char_CR && sptr[1] == char_EOL)
+                            sptr++;
+                        retcode = 0;
+                        ref_mark_new(myref);
+                        goto sret;
+                    case ctype_other:
+                        /*
+                         * A self-delimiting character ends the number too:
+                         * leave it to be rescanned rather than collecting
+                         * the number as a name and parsing it again.
+                         */
+                        if (newptr[-1] == ctrld) /* ^D is a name char here */
+                            break;
+                        sptr = newptr - 2;
+                        retcode = 0;
+                        ref_mark_new(myref);
+                        goto sret;
+                }
             }
             name_type = 0;
             try_number = true;
@@ -1049,6 +1138,7 @@ gs_scan_token(i_ctx_t *i_ctx_p, ref * pref, scanner_state * pstate)
             {
                 const byte *endp1 = endptr - 1;
 
+                sptr = scan_skip_name_blocks(sptr + 1, endp1 + 1) - 1;
                 do {
                     if (sptr >= endp1)  /* stop 1 early! */
                         goto dyn_name;
@@ -1129,6 +1129,20 @@ static int FAPI_FF_get_glyph(FAPI_font *ff, int char_code, byte *buf, ushort buf
                 glyph_length = max((ushort)(l - mc), 0); /* safety */
                 if (buf != 0 && glyph_length > 0)
                     memcpy(buf, data_ptr + mc, min(glyph_length, buf_length)/* safety */);
+            } else if (((gs_font_type42 *)ff->client_font_data)->data.gdcache != NULL) {
+                /* 'glyf' and 'loca' are not in sfnts, read the glyph from the font file. */
+                gs_font_type42 *pfont42 = (gs_font_type42 *)ff->client_font_data;
+                gs_glyph_data_t gdata;
+
+                gdata.memory = pfont42->memory;
+                if (pfont42->data.get_outline(pfont42, char_code, &gdata) < 0)
+                    glyph_length = -1;
+                else {
+                    glyph_length = gdata.bits.size;
+                    if (buf != 0 && glyph_length > 0)
+                        memcpy(buf, gdata.bits.data, min(glyph_length, buf_length)/* safety */);
+                    gs_glyph_data_free(&gdata, "FAPI_FF_get_glyph");
+                }
             } else {
                 gs_font_type42 *pfont42 = (gs_font_type42 *)ff->client_font_data;
                 ulong offset0, length_read;
@@ -1186,10 +1200,15 @@ static bool produce_outline_char (i_ctx_t *i_ctx_p, gs_show_enum *penum_s, gs_fo
      */
     gx_compute_text_oversampling(penum_s, (gs_font *)pbfont, abits, log2_scale);
 
+    /* Where gx_compute_text_oversampling allows anti-aliasing, the server
+     * renders coverage values instead of an oversampled bitmap, see
+     * compute_glyph_raster_params. Otherwise anti-aliased text is filled
+     * as an outline.
+     */
     return (pgs->in_charpath || pbfont->PaintType != 0 ||
             (pgs->in_cachedevice != CACHE_DEVICE_CACHING && using_transparency_pattern ((gs_state *)penum_s->pis)) ||
-            (pgs->in_cachedevice != CACHE_DEVICE_CACHING && (log2_scale->x > 0 || log2_scale->y > 0)) ||
-            (pgs->in_cachedevice != CACHE_DEVICE_CACHING && abits > 1));
+            (pgs->in_cachedevice != CACHE_DEVICE_CACHING && abits > 1 &&
+             log2_scale->x == 0 && log2_scale->y == 0));
 }
 
 static const FAPI_font ff_stub = {
@@ -1744,6 +1763,54 @@ static int fapi_copy_mono(gx_device *dev1, FAPI_raster *rast, int dx, int dy)
     }
 }
 
+/*
+ * Repack a raster with depth (1, 2 or 4) bits per pixel, rows aligned for
+ * the graphics library. Coverage values are scaled down to the alpha depth,
+ * monobit pixels become full alpha.
+ */
+static byte *fapi_pack_raster(gs_memory_t *mem, const FAPI_raster *rast, int depth, int *raster)
+{   int line_step = bitmap_raster(rast->width * depth);
+    int max_alpha = (1 << depth) - 1;
+    byte *p = gs_alloc_byte_array(mem, rast->height, line_step, "fapi_pack_raster");
+    int x, y;
+
+    if (p == NULL)
+        return NULL;
+    memset(p, 0, rast->height * line_step);
+    for (y = 0; y < rast->height; y++) {
+        const byte *r = (const byte *)rast->p + y * rast->line_step;
+        byte *q = p + y * line_step;
+
+        for (x = 0; x < rast->width; x++) {
+            int bit = x * depth;
+            uint a;
+
+            if (rast->depth == 8)
+                a = (r[x] * max_alpha + 127) / 255;
+            else
+                a = (r[x >> 3] & (0x80 >> (x & 7)) ? max_alpha : 0);
+            q[bit >> 3] |= a << (8 - depth - (bit & 7));
+        }
+    }
+    *raster = line_step;
+    return p;
+}
+
+/* Copy a raster into the cache device of a character with depth > 1 :
+ * the device is a monobit one holding depth bits per pixel, see gx_alloc_char_bits.
+ */
+static int fapi_copy_alpha(gx_device *dev1, FAPI_raster *rast, int dx, int dy, int depth)
+{   int line_step, code;
+    byte *p = fapi_pack_raster(dev1->memory, rast, depth, &line_step);
+
+    if (p == NULL)
+        return_error(e_VMerror);
+    code = dev_proc(dev1, copy_mono)(dev1, p, 0, line_step, 0, dx * depth, dy,
+                                     rast->width * depth, rast->height, 0, 1);
+    gs_free_object(dev1->memory, p, "fapi_pack_raster");
+    return code;
+}
+
 static const int frac_pixel_shift = 4;
 
 /* NOTE: fapi_image_uncached_glyph() doesn't check various paramters: it assumes fapi_finish_render_aux()
@@ -1762,10 +1829,20 @@ static int fapi_image_uncached_glyph (i_ctx_t *i_ctx_p, gs_show_enum *penum, FAP
     extern_st(st_gs_show_enum);
 
     byte *r = rast->p;
-    byte *src, *dst;
-    int h, padbytes, cpbytes, dstr = bitmap_raster(rast->width);
+    byte *src, *dst, *packed = NULL;
+    int h, padbytes, cpbytes, dstr, depth = 1;
     int sstr = rast->line_step;
 
+    if (rast->depth == 8) {
+        /* Coverage values : draw them as alpha if the color allows it. */
+        if (gs_color_writes_pure(pgs))
+            depth = (*dev_proc(dev, get_alpha_bits))(dev, go_text);
+        packed = r = fapi_pack_raster(penum->memory, rast, depth, &sstr);
+        if (packed == NULL)
+            return_error(e_VMerror);
+    }
+    dstr = bitmap_raster(rast->width * depth);
+
     /* we can only safely use the gx_image_fill_masked() "shortcut" if we're drawing
      * a "simple" colour, rather than a pattern.
      */
@@ -1817,15 +1894,15 @@ static int fapi_image_uncached_glyph (i_ctx_t *i_ctx_p, gs_show_enum *penum, FAP
                           (int)(pgs->ctm.tx + (double)rast_orig_x / (1 << frac_pixel_shift) + penum->fapi_glyph_shift.x + 0.5),
                           (int)(pgs->ctm.ty + (double)rast_orig_y / (1 << frac_pixel_shift) + penum->fapi_glyph_shift.y + 0.5),
                           rast->width, rast->height,
-                          pdcolor, 1, rop3_default, pcpath);
+                          pdcolor, depth, rop3_default, pcpath);
         } else {
             code = gx_image_fill_masked(dev, r, 0, dstr, 0,
                           (int)(pgs->ctm.tx + (double)rast_orig_x / (1 << frac_pixel_shift) + 0.5),
                           (int)(pgs->ctm.ty + (double)rast_orig_y / (1 << frac_pixel_shift) + 0.5),
                           rast->width, rast->height,
-                          pdcolor, 1, rop3_default, pcpath);
+                          pdcolor, depth, rop3_default, pcpath);
         }
-        if (rast->p != r) {
+        if (rast->p != r && r != packed) {
             gs_free_object(penum->memory, r, "fapi_finish_render_aux");
         }
     }
@@ -1839,6 +1916,7 @@ static int fapi_image_uncached_glyph (i_ctx_t *i_ctx_p, gs_show_enum *penum, FAP
         int x, y, w, h;
 
         if (!pie) {
+            gs_free_object(penum->memory, packed, "fapi_pack_raster");
             return_error(e_VMerror);
         }
 
@@ -1871,6 +1949,7 @@ static int fapi_image_uncached_glyph (i_ctx_t *i_ctx_p, gs_show_enum *penum, FAP
         if (code >= 0 && code1 < 0)
             code = code1;
     }
+    gs_free_object(penum->memory, packed, "fapi_pack_raster");
     return(code);
 }
 
@@ -1967,14 +2046,18 @@ static int fapi_finish_render_aux(i_ctx_t *i_ctx_p, gs_font_base *pbfont, FAPI_s
                     int rounding = 1 << (frac_pixel_shift - 1);
                     int dx = arith_rshift_slow((pgs->ctm.tx_fixed >> shift_rd) + rast_orig_x + rounding, frac_pixel_shift);
                     int dy = arith_rshift_slow((pgs->ctm.ty_fixed >> shift_rd) + rast_orig_y + rounding, frac_pixel_shift);
+                    /* An anti-aliased character keeps depth bits per pixel in a monobit device. */
+                    int depth = (gs_object_type(penum->memory, penum) == &st_gs_show_enum ?
+                                 cc_depth(penum_s->cc) : 1);
+                    int dev_width = dev1->width / depth;
 
-                    if (dx + rast.left_indent < 0 || dx + rast.left_indent + rast.black_width > dev1->width) {
+                    if (dx + rast.left_indent < 0 || dx + rast.left_indent + rast.black_width > dev_width) {
 #ifdef DEBUG
                         if (gs_debug_c('m')) {
                             emprintf2(dev1->memory,
                                       "Warning : Cropping a FAPI glyph while caching : dx=%d,%d.\n",
                                       dx + rast.left_indent,
-                                      dx + rast.left_indent + rast.black_width - dev1->width);
+                                      dx + rast.left_indent + rast.black_width - dev_width);
                         }
 #endif
                         if (dx + rast.left_indent < 0)
@@ -1992,7 +2075,11 @@ static int fapi_finish_render_aux(i_ctx_t *i_ctx_p, gs_font_base *pbfont, FAPI_s
                         if (dy + rast.top_indent < 0)
                             dy -= dy + rast.top_indent;
                     }
-                    if ((code = fapi_copy_mono(dev1, &rast, dx, dy)) < 0)
+                    if (depth == 1 && rast.depth != 8)
+                        code = fapi_copy_mono(dev1, &rast, dx, dy);
+                    else
+                        code = fapi_copy_alpha(dev1, &rast, dx, dy, depth);
+                    if (code < 0)
                         return code;
 
                     if (gs_object_type(penum->memory, penum) == &st_gs_show_enum) {
@@ -2044,6 +2131,148 @@ find_substring(const byte *where, int length, const char *what)
                            mtx1->yx == mtx2->yx && mtx1->yy == mtx2->yy && \
                            mtx1->tx == mtx2->tx && mtx1->ty == mtx2->ty)
 
+/* Compute the glyph index of a CID in a CIDFont substituted with a disk font. */
+static int
+FAPI_disk_cid_char_ref(i_ctx_t *i_ctx_p, FAPI_server *I, ref *pdr,
+                       int client_char_code, FAPI_char_ref *cr)
+{
+    ref *Decoding, *TT_cmap, *SubstNWP;
+    ref src_type, dst_type;
+    bool is_glyph_index = true;
+    uint c;
+    int code;
+
+    if (dict_find_string(pdr, "Decoding", &Decoding) <= 0 || !r_has_type(Decoding, t_dictionary))
+        return_error(e_invalidfont);
+    if (dict_find_string(pdr, "SubstNWP", &SubstNWP) <= 0 || !r_has_type(SubstNWP, t_array))
+        return_error(e_invalidfont);
+    if (dict_find_string(pdr, "TT_cmap", &TT_cmap) <= 0 || !r_has_type(TT_cmap, t_dictionary)) {
+        ref *DecodingArray, char_code, char_code1, ih;
+        int i = client_char_code % 256, n;
+
+        make_int(&ih, client_char_code / 256);
+        /* Check the Decoding array for this block of CIDs */
+        if (dict_find(Decoding, &ih, &DecodingArray) <= 0 ||
+                !r_has_type(DecodingArray, t_array) ||
+                array_get(imemory, DecodingArray, i, &char_code) < 0)
+            return_error(e_invalidfont);
+
+        /* Check the Decoding entry */
+        if (r_has_type(&char_code, t_integer))
+            n = 1;
+        else if (r_has_type(&char_code, t_array)) {
+            DecodingArray = &char_code;
+            i = 0;
+            n = r_size(DecodingArray);
+        } else
+            return_error(e_invalidfont);
+
+        for (;n--; i++) {
+            if (array_get(imemory, DecodingArray, i, &char_code1) < 0 ||
+                !r_has_type(&char_code1, t_integer))
+                return_error(e_invalidfont);
+
+            c = char_code1.value.intval;
+            I->check_cmap_for_GID(I, &c);
+            if (c != 0)
+                break;
+        }
+    } else {
+        ref *CIDSystemInfo;
+        ref *Ordering;
+
+        /* We only have to lookup the char code if we're *not* using an identity ordering */
+        if (dict_find_string(pdr, "CIDSystemInfo", &CIDSystemInfo) >= 0 && r_has_type(CIDSystemInfo, t_dictionary) &&
+            dict_find_string(CIDSystemInfo, "Ordering", &Ordering) >= 0 && r_has_type(Ordering, t_string) &&
+            strncmp((const char *)Ordering->value.bytes, "Identity", 8) != 0) {
+
+            code = cid_to_TT_charcode(imemory, Decoding, TT_cmap, SubstNWP,
+                        client_char_code, &c, &src_type, &dst_type);
+            if (code < 0)
+                return code;
+
+            /* cid_to_TT_charcode() returns 1 if it found a
+             * matching character code. Otherwise it returns
+             * zero after setting c to zero (.notdef glyph id)
+             * or a negative value on error. */
+#if 0
+            if (code > 0)
+                is_glyph_index = false;
+#endif
+        }
+        else {
+            c = client_char_code;
+        }
+    }
+    cr->char_codes[0] = c;
+    cr->is_glyph_index = is_glyph_index;
+    /* fixme : process the narrow/wide/proportional mapping type,
+       using src_type, dst_type. Should adjust the 'matrix' in FAPI_do_char.
+       Call get_font_proportional_feature for proper choice.
+    */
+    return 0;
+}
+
+/* The most characters FAPI_prefetch_chars looks at ahead in a show string. */
+#define FAPI_PREFETCH_CHARS 64
+
+/*
+ * Before rendering a character of a CIDFont substituted with a disk font,
+ * look ahead in the show string for the following characters of the same
+ * CIDFont that are not in the character cache, and ask the renderer to
+ * rasterize them together with this one on FAPIThreads threads. They reach
+ * the cache through FAPI_do_char as usual.
+ */
+static void
+FAPI_prefetch_chars(i_ctx_t *i_ctx_p, FAPI_server *I, gs_font_base *pbfont,
+                    gs_show_enum *penum_s, ref *pdr, const FAPI_char_ref *pcr)
+{
+    uint threads = gs_currentfapithreads(pbfont->dir);
+    FAPI_char_ref cr[FAPI_PREFETCH_CHARS];
+    gs_show_enum penum;
+    gs_font *rfont;
+    int n = 1, i, j;
+
+    if (threads < 2 || I->prefetch_char_rasters == NULL ||
+        penum_s->fstack.depth < 0 || penum_s->pair == NULL ||
+        penum_s->pair->font != (gs_font *)pbfont)
+        return;
+    rfont = penum_s->fstack.items[0].font;
+    /* The current character comes first, so it is rendered in the batch too. */
+    cr[0] = *pcr;
+    /* Decode the rest of the string on a copy of the enumerator. */
+    penum = *penum_s;
+    for (i = 0; i < FAPI_PREFETCH_CHARS; i++) {
+        gs_char chr;
+        gs_glyph glyph;
+        int code = rfont->procs.next_char_glyph((gs_text_enum_t *)&penum, &chr, &glyph);
+        int cid;
+
+        if (code < 0 || code == 2)
+            break;
+        if (penum.fstack.items[penum.fstack.depth].font != (gs_font *)pbfont ||
+            glyph < GS_MIN_CID_GLYPH || glyph >= GS_MIN_GLYPH_INDEX)
+            continue;
+        cid = glyph - GS_MIN_CID_GLYPH;
+        if (gx_char_cached(pbfont->dir, penum_s->pair, glyph, rfont->WMode))
+            continue;
+        for (j = 0; j < n && cr[j].client_char_code != cid; j++)
+            ;
+        if (j < n)
+            continue;
+        memset(&cr[n], 0x00, sizeof(cr[n]));
+        cr[n].char_codes_count = 1;
+        cr[n].metrics_type = FAPI_METRICS_NOTDEF;
+        if (FAPI_disk_cid_char_ref(i_ctx_p, I, pdr, cid, &cr[n]) < 0)
+            break;
+        cr[n].char_code = cr[n].char_codes[0];
+        cr[n].client_char_code = cid;
+        n++;
+    }
+    if (n > 1)
+        I->prefetch_char_rasters(I, &I->ff, cr, n, threads);
+}
+
 static int FAPI_do_char(i_ctx_t *i_ctx_p, gs_font_base *pbfont, gx_device *dev, char *font_file_path, bool bBuildGlyph, ref *charstring)
 {   /* Stack : <font> <code|name> --> - */
     os_ptr op = osp;
@@ -2118,6 +2347,7 @@ static int FAPI_do_char(i_ctx_t *i_ctx_p, gs_font_base *pbfont, gx_device *dev,
         return_error(e_undefined);
 
     I->use_outline = produce_outline_char(i_ctx_p, penum_s, pbfont, alpha_bits, &log2_scale);
+    I->anti_alias = !I->use_outline && (log2_scale.x > 0 || log2_scale.y > 0);
     if (I->use_outline) {
         I->max_bitmap = 0;
     }
@@ -2140,6 +2370,11 @@ static int FAPI_do_char(i_ctx_t *i_ctx_p, gs_font_base *pbfont, gx_device *dev,
         log2_scale.x = 0;
         log2_scale.y = 0;
     }
+    if (I->anti_alias) {
+        /* The coverage values are rendered at the device resolution. */
+        log2_scale.x = 0;
+        log2_scale.y = 0;
+    }
 
     /* Prepare font data
      * This needs done here (earlier than it used to be) because FAPI/UFST has conflicting
@@ -2290,79 +2525,9 @@ retry_oversampling:
     cr.char_codes_count = 1;
     if (bCID) {
         if (font_file_path != NULL) {
-            ref *Decoding, *TT_cmap, *SubstNWP;
-            ref src_type, dst_type;
-            bool is_glyph_index = true;
-            uint c;
-
-            if (dict_find_string(pdr, "Decoding", &Decoding) <= 0 || !r_has_type(Decoding, t_dictionary))
-                return_error(e_invalidfont);
-            if (dict_find_string(pdr, "SubstNWP", &SubstNWP) <= 0 || !r_has_type(SubstNWP, t_array))
-                return_error(e_invalidfont);
-            if (dict_find_string(pdr, "TT_cmap", &TT_cmap) <= 0 || !r_has_type(TT_cmap, t_dictionary)) {
-                ref *DecodingArray, char_code, char_code1, ih;
-                int i = client_char_code % 256, n;
-
-                make_int(&ih, client_char_code / 256);
-                /* Check the Decoding array for this block of CIDs */
-                if (dict_find(Decoding, &ih, &DecodingArray) <= 0 ||
-                        !r_has_type(DecodingArray, t_array) ||
-                        array_get(imemory, DecodingArray, i, &char_code) < 0)
-                    return_error(e_invalidfont);
-
-                /* Check the Decoding entry */
-                if (r_has_type(&char_code, t_integer))
-                    n = 1;
-                else if (r_has_type(&char_code, t_array)) {
-                    DecodingArray = &char_code;
-                    i = 0;
-                    n = r_size(DecodingArray);
-                } else
-                    return_error(e_invalidfont);
-
-                for (;n--; i++) {
-                    if (array_get(imemory, DecodingArray, i, &char_code1) < 0 ||
-                        !r_has_type(&char_code1, t_integer))
-                        return_error(e_invalidfont);
-
-                    c = char_code1.value.intval;
-                    I->check_cmap_for_GID(I, &c);
-                    if (c != 0)
-                        break;
-                }
-            } else {
-                ref *CIDSystemInfo;
-                ref *Ordering;
-
-                /* We only have to lookup the char code if we're *not* using an identity ordering */
-                if (dict_find_string(pdr, "CIDSystemInfo", &CIDSystemInfo) >= 0 && r_has_type(CIDSystemInfo, t_dictionary) &&
-                    dict_find_string(CIDSystemInfo, "Ordering", &Ordering) >= 0 && r_has_type(Ordering, t_string) &&
-                    strncmp((const char *)Ordering->value.bytes, "Identity", 8) != 0) {
-
-                    code = cid_to_TT_charcode(imemory, Decoding, TT_cmap, SubstNWP,
-                                client_char_code, &c, &src_type, &dst_type);
-                    if (code < 0)
-                        return code;
-
-                    /* cid_to_TT_charcode() returns 1 if it found a
-                     * matching character code. Otherwise it returns
-                     * zero after setting c to zero (.notdef glyph id)
-                     * or a negative value on error. */
-#if 0
-                     if (code > 0)
-                         is_glyph_index = false;
-#endif
-                 }
-                 else {
-                     c = client_char_code;
-                 }
-             }
-             cr.char_codes[0] = c;
-             cr.is_glyph_index = is_glyph_index;
-             /* fixme : process the narrow/wide/proportional mapping type,
-                using src_type, dst_type. Should adjust the 'matrix' above.
-                Call get_font_proportional_feature for proper choice.
-             */
+            code = FAPI_disk_cid_char_ref(i_ctx_p, I, pdr, client_char_code, &cr);
+            if (code < 0)
+                return code;
          } else {
              ref *CIDMap;
              byte *Map;
@@ -2643,6 +2808,8 @@ retry_oversampling:
 
         code = I->get_char_outline_metrics(I, &I->ff, &cr, &metrics);
     } else {
+        if (bCID && font_file_path != NULL)
+            FAPI_prefetch_chars(i_ctx_p, I, pbfont, penum_s, pdr, &cr);
 #if 0 /* Debug purpose only. */
         code = e_limitcheck;
 #else
@@ -21,6 +21,7 @@
 #include "ghost.h"
 #include "oper.h"
 #include "gsmemory.h"
+#include "gsstate.h"		/* for gs_currentdctdecodethreads */
 #include "strimpl.h"
 #include "sdct.h"
 #include "sjpeg.h"
@@ -85,6 +86,7 @@ zDCTD(i_ctx_t *i_ctx_p)
         goto fail;
     if ((code = s_DCTD_put_params((gs_param_list *) & list, &state)) < 0)
         goto rel;
+    state.DecodeThreads = gs_currentdctdecodethreads(imemory);
     /* Create the filter. */
     jddp->templat = s_DCTD_template;
     code = filter_read(i_ctx_p, 0, &jddp->templat,
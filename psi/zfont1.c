@@ -183,6 +183,7 @@ charstring_font_params(const gs_memory_t *mem,
      * and check the hashes. Zero except when in use by pdfwrite..
      */
     memset(&pdata1->hash_subrs, 0x00, 16);
+    pdata1->client_OtherSubrs = false;
     return 0;
 }
 
@@ -0,0 +1,336 @@
+/* Copyright (C) 2001-2012 Artifex Software, Inc.
+   All Rights Reserved.
+
+   This software is provided AS-IS with no warranty, either express or
+   implied.
+
+   This software is distributed under license and may not be copied,
+   modified or distributed except as expressly authorized under the terms
+   of the license contained in the file LICENSE in this distribution.
+
+   Refer to licensing information at http://www.artifex.com or contact
+   Artifex Software, Inc.,  7 Mt. Lassen Drive - Suite A-134, San Rafael,
+   CA  94903, U.S.A., +1(415)492-9861, for further information.
+*/
+
+
+/* Persistent font index operators */
+
+/* The font index keeps the result of parsing a Fontmap file or of
+ * scanning a font directory in the persistent cache (gp_cache_insert /
+ * gp_cache_query), so that later runs can skip the parsing and the
+ * directory scans.  The key is the MD5 digest of whatever determines
+ * the result: the contents of the Fontmap, or the directory name and
+ * its file list.  A changed source gets a new key, and the stale entry
+ * is left for the cache to expire.
+ *
+ * An entry is a flat array of names, strings and nulls.  It is stored
+ * as a header (magic, revision, element count) followed by one record
+ * per element: a type byte, a 2-byte big-endian length and the bytes.
+ * See gs_fonts.ps for how the arrays are laid out.
+ */
+
+#include "memory_.h"
+#include "ghost.h"
+#include "oper.h"
+#include "gp.h"
+#include "gscdefs.h"
+#include "ialloc.h"
+#include "iname.h"
+#include "iutil.h"
+#include "md5.h"
+#include "store.h"
+#include "stream.h"
+#include "files.h"
+
+#define FONT_INDEX_MAGIC "GSfi"
+#define FONT_INDEX_HEADER_SIZE 12
+
+/* Element types */
+#define FONT_INDEX_NULL 0
+#define FONT_INDEX_NAME 1
+#define FONT_INDEX_STRING 2
+
+typedef struct font_index_key_s {
+    char magic[4];
+    long revision;
+    gs_md5_byte_t digest[16];
+} font_index_key;
+
+static void
+font_index_put_u32(byte *p, uint v)
+{
+    p[0] = (byte)(v >> 24);
+    p[1] = (byte)(v >> 16);
+    p[2] = (byte)(v >> 8);
+    p[3] = (byte)v;
+}
+
+static uint
+font_index_get_u32(const byte *p)
+{
+    return ((uint)p[0] << 24) + ((uint)p[1] << 16) + ((uint)p[2] << 8) + p[3];
+}
+
+/* Make the cache key from a string or an array of strings. */
+static int
+font_index_make_key(const gs_memory_t *mem, const ref *op, font_index_key *pkey)
+{
+    gs_md5_state_t md5;
+    static const gs_md5_byte_t sep = 0;
+
+    memset(pkey, 0, sizeof(*pkey));	/* clear the padding */
+    memcpy(pkey->magic, FONT_INDEX_MAGIC, 4);
+    pkey->revision = gs_revision;
+    gs_md5_init(&md5);
+    if (r_has_type(op, t_string)) {
+        check_read(*op);
+        gs_md5_append(&md5, op->value.const_bytes, r_size(op));
+    } else if (r_is_array(op)) {
+        uint i, size = r_size(op);
+
+        check_read(*op);
+        for (i = 0; i < size; i++) {
+            ref elt;
+
+            array_get(mem, op, (long)i, &elt);
+            if (!r_has_type(&elt, t_string))
+                return_error(e_typecheck);
+            gs_md5_append(&md5, elt.value.const_bytes, r_size(&elt));
+            gs_md5_append(&md5, &sep, 1);
+        }
+    } else
+        return_error(e_typecheck);
+    gs_md5_finish(&md5, pkey->digest);
+    return 0;
+}
+
+static void *
+font_index_alloc(void *userdata, int bytes)
+{
+    return gs_alloc_bytes((gs_memory_t *)userdata, bytes, "font_index_alloc");
+}
+
+/*
+ * Decode an entry into a new array; return false if it is malformed.
+ * The array is filled with nulls first, so that it is always valid,
+ * even if we give up part way through.
+ */
+static int
+font_index_decode(i_ctx_t *i_ctx_p, const byte *data, uint len, ref *parray)
+{
+    const byte *p = data + FONT_INDEX_HEADER_SIZE, *end = data + len;
+    uint count, i;
+    int code;
+
+    if (len < FONT_INDEX_HEADER_SIZE || memcmp(data, FONT_INDEX_MAGIC, 4) ||
+        font_index_get_u32(data + 4) != (uint)gs_revision)
+        return 0;
+    count = font_index_get_u32(data + 8);
+    if (count > (len - FONT_INDEX_HEADER_SIZE) / 3)
+        return 0;
+    code = ialloc_ref_array(parray, a_all | icurrent_space, count,
+                            ".fontindexget");
+    if (code < 0)
+        return code;
+    refset_null(parray->value.refs, count);
+    for (i = 0; i < count; i++) {
+        ref *pelt = parray->value.refs + i;
+        uint size;
+        byte *str;
+
+        if (end - p < 3)
+            return 0;
+        size = (p[1] << 8) + p[2];
+        if (end - p - 3 < size)
+            return 0;
+        switch (p[0]) {
+            case FONT_INDEX_NULL:
+                make_null(pelt);
+                break;
+            case FONT_INDEX_NAME:
+                code = name_ref(imemory, p + 3, size, pelt, 1);
+                if (code < 0)
+                    return code;
+                break;
+            case FONT_INDEX_STRING:
+                str = ialloc_string(size, ".fontindexget");
+                if (str == 0)
+                    return_error(e_VMerror);
+                memcpy(str, p + 3, size);
+                make_string(pelt, a_all | icurrent_space, size, str);
+                break;
+            default:
+                return 0;
+        }
+        p += 3 + size;
+    }
+    return 1;
+}
+
+/* <key> .fontindexget <array> true */
+/* <key> .fontindexget false */
+static int
+zfontindexget(i_ctx_t *i_ctx_p)
+{
+    os_ptr op = osp;
+    font_index_key key;
+    gs_memory_t *mem = imemory->non_gc_memory;
+    void *data = 0;
+    ref array;
+    int len, code;
+
+    code = font_index_make_key(imemory, op, &key);
+    if (code < 0)
+        return code;
+    len = gp_cache_query(GP_CACHE_TYPE_FONTMAP, (byte *)&key, sizeof(key),
+                         &data, font_index_alloc, mem);
+    if (len <= 0 || data == 0) {
+        make_false(op);
+        return 0;
+    }
+    code = font_index_decode(i_ctx_p, data, len, &array);
+    gs_free_object(mem, data, ".fontindexget");
+    if (code < 0)
+        return code;
+    if (code == 0) {
+        make_false(op);
+        return 0;
+    }
+    ref_assign(op, &array);
+    push(1);
+    make_true(op);
+    return 0;
+}
+
+/* <key> <array> .fontindexput - */
+static int
+zfontindexput(i_ctx_t *i_ctx_p)
+{
+    os_ptr op = osp;
+    font_index_key key;
+    gs_memory_t *mem = imemory->non_gc_memory;
+    uint count, size = FONT_INDEX_HEADER_SIZE, i;
+    byte *data, *p;
+    int code;
+
+    if (!r_is_array(op))
+        return_op_typecheck(op);
+    check_read(*op);
+    code = font_index_make_key(imemory, op - 1, &key);
+    if (code < 0)
+        return code;
+    count = r_size(op);
+    for (i = 0; i < count; i++) {
+        ref elt, sref;
+
+        array_get(imemory, op, (long)i, &elt);
+        switch (r_type(&elt)) {
+            case t_null:
+                r_set_size(&sref, 0);
+                break;
+            case t_name:
+                name_string_ref(imemory, &elt, &sref);
+                break;
+            case t_string:
+                sref = elt;
+                break;
+            default:
+                return_error(e_typecheck);
+        }
+        if (r_size(&sref) > 0xffff)
+            return_error(e_limitcheck);
+        size += 3 + r_size(&sref);
+    }
+    data = gs_alloc_bytes(mem, size, ".fontindexput");
+    if (data == 0)
+        return_error(e_VMerror);
+    memcpy(data, FONT_INDEX_MAGIC, 4);
+    font_index_put_u32(data + 4, (uint)gs_revision);
+    font_index_put_u32(data + 8, count);
+    p = data + FONT_INDEX_HEADER_SIZE;
+    for (i = 0; i < count; i++) {
+        ref elt, sref;
+
+        array_get(imemory, op, (long)i, &elt);
+        switch (r_type(&elt)) {
+            case t_null:
+                p[0] = FONT_INDEX_NULL;
+                r_set_size(&sref, 0);
+                break;
+            case t_name:
+                p[0] = FONT_INDEX_NAME;
+                name_string_ref(imemory, &elt, &sref);
+                break;
+            default:
+                p[0] = FONT_INDEX_STRING;
+                sref = elt;
+                break;
+        }
+        p[1] = (byte)(r_size(&sref) >> 8);
+        p[2] = (byte)r_size(&sref);
+        if (r_size(&sref))
+            memcpy(p + 3, sref.value.const_bytes, r_size(&sref));
+        p += 3 + r_size(&sref);
+    }
+    /* A failure to write the cache only costs a rescan next time. */
+    gp_cache_insert(GP_CACHE_TYPE_FONTMAP, (byte *)&key, sizeof(key), data, size);
+    gs_free_object(mem, data, ".fontindexput");
+    pop(2);
+    return 0;
+}
+
+/* <file> .fontindexread <string> */
+/* Read the rest of a file into a string. */
+static int
+zfontindexread(i_ctx_t *i_ctx_p)
+{
+    os_ptr op = osp;
+    gs_memory_t *mem = imemory->non_gc_memory;
+    stream *s;
+    byte *buf = 0, *str;
+    uint size = 0, capacity = 0, n;
+    int status;
+
+    check_read_file(i_ctx_p, s, op);
+    for (;;) {
+        if (size == capacity) {
+            uint new_capacity = (capacity ? capacity * 2 : 8192);
+            byte *new_buf = gs_alloc_bytes(mem, new_capacity, ".fontindexread");
+
+            if (new_buf == 0) {
+                gs_free_object(mem, buf, ".fontindexread");
+                return_error(e_VMerror);
+            }
+            if (size)
+                memcpy(new_buf, buf, size);
+            gs_free_object(mem, buf, ".fontindexread");
+            buf = new_buf;
+            capacity = new_capacity;
+        }
+        status = sgets(s, buf + size, capacity - size, &n);
+        size += n;
+        if (status == EOFC)
+            break;
+        if (status < 0) {
+            gs_free_object(mem, buf, ".fontindexread");
+            return_error(e_ioerror);
+        }
+    }
+    str = ialloc_string(size, ".fontindexread");
+    if (str == 0) {
+        gs_free_object(mem, buf, ".fontindexread");
+        return_error(e_VMerror);
+    }
+    memcpy(str, buf, size);
+    gs_free_object(mem, buf, ".fontindexread");
+    make_string(op, a_all | icurrent_space, size, str);
+    return 0;
+}
+
+const op_def zfontidx_op_defs[] = {
+    {"1.fontindexget", zfontindexget},
+    {"2.fontindexput", zfontindexput},
+    {"1.fontindexread", zfontindexread},
+    op_def_end(0)
+};
@@ -43,6 +43,7 @@ gs_build_function_0(i_ctx_t *i_ctx_p, const ref *op, const gs_function_params_t
     *(gs_function_params_t *) & params = *mnDR;
     params.Encode = params.Decode = NULL;
     params.pole = NULL;
+    params.samples = NULL;
     params.Size = params.array_step = params.stream_step = NULL;
     if ((code = dict_find_string(op, "DataSource", &pDataSource)) <= 0)
         return (code < 0 ? code : gs_note_error(e_rangecheck));
@@ -19,11 +19,14 @@
 #include "oper.h"
 #include "idict.h"
 #include "strimpl.h"
+#include "scfx.h"
+#include "slzwx.h"
 #include "spdiffx.h"
 #include "spngpx.h"
 #include "szlibx.h"
 #include "idparam.h"
 #include "ifilter.h"
+#include "ifilter2.h"
 #include "ifrpred.h"
 #include "ifwpred.h"
 
@@ -83,9 +86,29 @@ zFlateE(i_ctx_t *i_ctx_p)
 static int
 zFlateD(i_ctx_t *i_ctx_p)
 {
+    os_ptr op = osp;
     stream_zlib_state zls;
+    int predictor, code;
 
     (*s_zlibD_template.set_defaults)((stream_state *)&zls);
+    if (r_has_type(op, t_dictionary)) {
+        /* Undo PNG prediction in the Flate stream itself. */
+        if ((code = dict_int_param(op, "Predictor", 0, 15, 1,
+                                   &predictor)) < 0)
+            return code;
+        if (predictor >= 10) {
+            stream_PNGP_state pps;
+
+            if ((code = zpp_setup(op, &pps)) < 0)
+                return code;
+            zls.Predictor = predictor;
+            zls.Colors = pps.Colors;
+            zls.BitsPerComponent = pps.BitsPerComponent;
+            zls.Columns = pps.Columns;
+            return filter_read(i_ctx_p, 0, &s_zlibD_template,
+                               (stream_state *)&zls, 0);
+        }
+    }
     return filter_read_predictor(i_ctx_p, 0, &s_zlibD_template,
                                  (stream_state *)&zls);
 }
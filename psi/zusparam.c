@@ -166,6 +166,30 @@ current_CurFontCache(i_ctx_t *i_ctx_p)
     return cstat[0];
 }
 static long
+current_FontCacheHits(i_ctx_t *i_ctx_p)
+{
+    ulong cstat[3];
+
+    gs_cachestats(ifont_dir, cstat);
+    return (long)min(cstat[0], max_long);
+}
+static long
+current_FontCacheMisses(i_ctx_t *i_ctx_p)
+{
+    ulong cstat[3];
+
+    gs_cachestats(ifont_dir, cstat);
+    return (long)min(cstat[1], max_long);
+}
+static long
+current_FontCacheEvictions(i_ctx_t *i_ctx_p)
+{
+    ulong cstat[3];
+
+    gs_cachestats(ifont_dir, cstat);
+    return (long)min(cstat[2], max_long);
+}
+static long
 current_MaxGlobalVM(i_ctx_t *i_ctx_p)
 {
     gs_memory_gc_status_t stat;
@@ -188,6 +212,28 @@ current_Revision(i_ctx_t *i_ctx_p)
 {
     return gs_revision;
 }
+static long
+current_DCTDecodeThreads(i_ctx_t *i_ctx_p)
+{
+    return gs_currentdctdecodethreads(imemory);
+}
+static int
+set_DCTDecodeThreads(i_ctx_t *i_ctx_p, long val)
+{
+    gs_setdctdecodethreads(imemory, (int)val);
+    return 0;
+}
+static long
+current_FAPIThreads(i_ctx_t *i_ctx_p)
+{
+    return gs_currentfapithreads(ifont_dir);
+}
+static int
+set_FAPIThreads(i_ctx_t *i_ctx_p, long val)
+{
+    gs_setfapithreads(ifont_dir, (uint)val);
+    return 0;
+}
 static const long_param_def_t system_long_params[] =
 {
     {"BuildTime", min_long, max_long, current_BuildTime, NULL},
@@ -195,7 +241,14 @@ static const long_param_def_t system_long_params[] =
     {"CurFontCache", 0, MAX_UINT_PARAM, current_CurFontCache, NULL},
     {"Revision", min_long, max_long, current_Revision, NULL},
     /* Extensions */
-    {"MaxGlobalVM", 0, max_long, current_MaxGlobalVM, set_MaxGlobalVM}
+    {"MaxGlobalVM", 0, max_long, current_MaxGlobalVM, set_MaxGlobalVM},
+    {"FontCacheHits", 0, max_long, current_FontCacheHits, NULL},
+    {"FontCacheMisses", 0, max_long, current_FontCacheMisses, NULL},
+    {"FontCacheEvictions", 0, max_long, current_FontCacheEvictions, NULL},
+    {"DCTDecodeThreads", 0, 16,
+     current_DCTDecodeThreads, set_DCTDecodeThreads},
+    {"FAPIThreads", 0, 16,
+     current_FAPIThreads, set_FAPIThreads}
 };
 
 /* Boolean values */
@@ -451,9 +504,54 @@ set_GridFitTT(i_ctx_t *i_ctx_p, long val)
     gs_setgridfittt(ifont_dir, (uint)val);
     return 0;
 }
+static long
+current_GlyphDiskCache(i_ctx_t *i_ctx_p)
+{
+    return gs_currentglyphdiskcache(ifont_dir);
+}
+
+/*
+ * <bool> .setglyphdiskcache -
+ * GlyphDiskCache is read-only as a user parameter: gs_init.ps sets it
+ * from the command line and then removes this operator.
+ */
+static int
+zsetglyphdiskcache(i_ctx_t *i_ctx_p)
+{
+    os_ptr op = osp;
+
+    check_type(*op, t_boolean);
+    gs_setglyphdiskcache(ifont_dir, op->value.boolval);
+    pop(1);
+    return 0;
+}
 
 #undef ifont_dir
 
+static long
+current_CoverageFill(i_ctx_t *i_ctx_p)
+{
+    return gs_currentcoveragefill(imemory);
+}
+static int
+set_CoverageFill(i_ctx_t *i_ctx_p, long val)
+{
+    gs_setcoveragefill(imemory, (int)val);
+    return 0;
+}
+
+static long
+current_FillThreads(i_ctx_t *i_ctx_p)
+{
+    return gs_currentfillthreads(imemory);
+}
+static int
+set_FillThreads(i_ctx_t *i_ctx_p, long val)
+{
+    gs_setfillthreads(imemory, (int)val);
+    return 0;
+}
+
 static void
 current_devicen_icc(i_ctx_t *i_ctx_p, gs_param_string * pval)
 {
@@ -578,7 +676,13 @@ static const long_param_def_t user_long_params[] =
     {"AlignToPixels", 0, 1,
      current_AlignToPixels, set_AlignToPixels},
     {"GridFitTT", 0, 3,
-     current_GridFitTT, set_GridFitTT}
+     current_GridFitTT, set_GridFitTT},
+    {"GlyphDiskCache", 0, 1,
+     current_GlyphDiskCache, NULL},
+    {"CoverageFill", 0, max_int,
+     current_CoverageFill, set_CoverageFill},
+    {"FillThreads", 0, 64,
+     current_FillThreads, set_FillThreads}
 };
 
 /* Note that string objects that are maintained as user params must be
@@ -743,6 +847,7 @@ const op_def zusparam_op_defs[] =
     {"1.getuserparam", zgetuserparam},
     {"1.setsystemparams", zsetsystemparams},
     {"1.setuserparams", zsetuserparams},
+    {"1.setglyphdiskcache", zsetglyphdiskcache},
         /* The rest of the operators are defined only in Level 2. */
     op_def_begin_level2(),
     {"1.checkpassword", zcheckpassword},